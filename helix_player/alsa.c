@@ -24,9 +24,9 @@ int alsa_device_open(unsigned int channels, unsigned int sample_rate, unsigned i
     snd_pcm_hw_params_alloca(&params);
     snd_pcm_hw_params_any(pcm_handle, params);
 
-    // 设置交错模式
+    // 设置非交错模式 (每个声道一个缓冲区, 与解码器的平面输出对应)
     if ((rc = snd_pcm_hw_params_set_access(pcm_handle, params, 
-            SND_PCM_ACCESS_RW_INTERLEAVED)) < 0) {
+            SND_PCM_ACCESS_RW_NONINTERLEAVED)) < 0) {
         fprintf(stderr, "Access type error: %s\n", snd_strerror(rc));
         goto err;
     }
@@ -107,11 +107,11 @@ err:
     return -1;
 }
 
-int alsa_device_write(int16_t *pcm, size_t frames)
+int alsa_device_write(int16_t **pcm, size_t frames)
 {
     // 验证输入参数
-    if (pcm == NULL || frames == 0) {
-        fprintf(stderr, "Invalid PCM data: %p, frames: %zu\n", pcm, frames);
+    if (pcm == NULL || pcm[0] == NULL || frames == 0) {
+        fprintf(stderr, "Invalid PCM data: %p, frames: %zu\n", (void *)pcm, frames);
         return -1;
     }
 
@@ -131,13 +131,13 @@ int alsa_device_write(int16_t *pcm, size_t frames)
     }
 
     // 写入音频数据
-    snd_pcm_sframes_t written = snd_pcm_writei(pcm_handle, pcm, frames);
+    snd_pcm_sframes_t written = snd_pcm_writen(pcm_handle, (void **)pcm, frames);
     
     if (written == -EPIPE) {  // Underrun处理
         fprintf(stderr, "Underrun occurred (frames: %zu, ch: %u)\n", frames, channels);
         snd_pcm_prepare(pcm_handle);
         // 重试写入
-        written = snd_pcm_writei(pcm_handle, pcm, frames);
+        written = snd_pcm_writen(pcm_handle, (void **)pcm, frames);
     } 
     
     if (written < 0) {
@@ -7,12 +7,16 @@
 
 // ALSA functions declaration
 int alsa_device_open(unsigned int channels, unsigned int sample_rate, unsigned int format_bits);
-int alsa_device_write(int16_t *pcm, size_t frames);
+int alsa_device_write(int16_t **pcm, size_t frames);
 void alsa_device_close(void);
 
+#define DECODE_BATCH_FRAMES 8                       // 每次调用解码的最大帧数
+
 static HMP3Decoder hMP3Decoder;
-static MP3FrameInfo mp3FrameInfo;
-short pcm[MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+static MP3FrameInfo mp3FrameInfo[DECODE_BATCH_FRAMES];
+short pcm[DECODE_BATCH_FRAMES * MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+// 平面输出: 左声道在前半部分, 右声道在后半部分
+static int16_t *pcm_planes[MAX_NCHAN] = { pcm, pcm + DECODE_BATCH_FRAMES * MAX_NGRAN * MAX_NSAMP };
 
 int main(int argc, char **argv)
 {
@@ -60,83 +64,69 @@ int main(int argc, char **argv)
         return -1;
     }
 
-    // 解码一帧
+    // 流水线解码: Huffman/反量化 与 IMDCT/子带合成 在两个线程上重叠 (无线程时保持串行)
+    MP3SetPipelined(hMP3Decoder, 1);
+
+    // 平面 (非交错) PCM 输出, 直接交给 snd_pcm_writen, 不需要再做声道交错/解交错
+    MP3SetPlanarOutput(hMP3Decoder, 1);
+
+    // 批量解码, 每次最多 DECODE_BATCH_FRAMES 帧
     uint8_t *data_ptr = data;
     int data_size = size;
     while (data_size > 0) {
-        /* find start of next MP3 frame - assume EOF if no sync found */
-        int offset = MP3FindSyncWord(data_ptr, data_size);
-        if (offset < 0) {
-            printf("No sync word found\n");
+        int nFrames = 0;
+        int err = MP3DecodeFrames(hMP3Decoder, &data_ptr, &data_size, pcm, sizeof(pcm) / sizeof(pcm[0]),
+                                  mp3FrameInfo, DECODE_BATCH_FRAMES, &nFrames);
+        if (err && err != ERR_MP3_INDATA_UNDERFLOW) {
+            printf("MP3 decoder: error %d\n", err);
             goto error;
         }
 
-        data_ptr += offset;
-        data_size -= offset;
-        
-        int err = MP3Decode(hMP3Decoder, &data_ptr, &data_size, pcm, 0);
-        if (err) {
-            switch (err) {
-                case ERR_MP3_INDATA_UNDERFLOW:
-                    printf("MP3 decoder: INDATA_UNDERFLOW\n");
-                    break;
-                case ERR_MP3_MAINDATA_UNDERFLOW:
-                    printf("MP3 decoder: MAINDATA_UNDERFLOW\n");
-                    break;
-                case ERR_MP3_FREE_BITRATE_SYNC:
-                    printf("MP3 decoder: FREE_BITRATE_SYNC\n");
-                    break;
-                default:
-                    printf("MP3 decoder: error %d\n", err);
-                    break;
-            }
-        } else {
-            MP3GetLastFrameInfo(hMP3Decoder, &mp3FrameInfo);
-
+        if (nFrames > 0) {
             //打印 MP3 信息
             if (init == 0) {
-                printf(" \r\n Bitrate       %dKbps", mp3FrameInfo.bitrate/1000);
-                printf(" \r\n Samprate      %dHz",   mp3FrameInfo.samprate);
-                printf(" \r\n BitsPerSample %db",    mp3FrameInfo.bitsPerSample);
-                printf(" \r\n nChans        %d",     mp3FrameInfo.nChans);
-                printf(" \r\n Layer         %d",     mp3FrameInfo.layer);
-                printf(" \r\n Version       %d",     mp3FrameInfo.version);
-                printf(" \r\n OutputSamps   %d",     mp3FrameInfo.outputSamps);
+                printf(" \r\n Bitrate       %dKbps", mp3FrameInfo[0].bitrate/1000);
+                printf(" \r\n Samprate      %dHz",   mp3FrameInfo[0].samprate);
+                printf(" \r\n BitsPerSample %db",    mp3FrameInfo[0].bitsPerSample);
+                printf(" \r\n nChans        %d",     mp3FrameInfo[0].nChans);
+                printf(" \r\n Layer         %d",     mp3FrameInfo[0].layer);
+                printf(" \r\n Version       %d",     mp3FrameInfo[0].version);
+                printf(" \r\n OutputSamps   %d",     mp3FrameInfo[0].outputSamps);
                 printf("\r\n");
                         
-                if (mp3FrameInfo.nChans == 0 || mp3FrameInfo.samprate == 0) {
-                    printf("Invalid MP3 format: channels=%d, sample_rate=%d\n", mp3FrameInfo.nChans, mp3FrameInfo.samprate);
+                if (mp3FrameInfo[0].nChans == 0 || mp3FrameInfo[0].samprate == 0) {
+                    printf("Invalid MP3 format: channels=%d, sample_rate=%d\n", mp3FrameInfo[0].nChans, mp3FrameInfo[0].samprate);
                     goto error;
                 }
             
-                if (alsa_device_open(mp3FrameInfo.nChans, mp3FrameInfo.samprate, mp3FrameInfo.bitsPerSample) < 0) {
+                if (alsa_device_open(mp3FrameInfo[0].nChans, mp3FrameInfo[0].samprate, mp3FrameInfo[0].bitsPerSample) < 0) {
                     printf("Failed to open ALSA device\n");
                     goto error;
                 }
                 init = 1;
             }
 
-
-            if (mp3FrameInfo.outputSamps == 0) {
-                printf("Invalid MP3 format: outputSamps=%d\n", mp3FrameInfo.outputSamps);
-                goto error;
-            }
+            int samps = 0;
+            for (int i = 0; i < nFrames; i++)
+                samps += mp3FrameInfo[i].outputSamps;
 
             printf("Decoded frame %ld/%zu (%.1f%%)\r", data_ptr - data, size, (float)(data_ptr - data)/size*100);
             fflush(stdout);
 
-            int frames = mp3FrameInfo.outputSamps / mp3FrameInfo.nChans;
+            int frames = samps / mp3FrameInfo[0].nChans;
 
             // 写入音频数据
-            int write_result = alsa_device_write(pcm, frames);
+            int write_result = alsa_device_write(pcm_planes, frames);
             if (write_result < 0) {
                 printf("ALSA write failed: %d (frames: %d, ch: %d, rate: %d)\n", 
-                      write_result, frames, mp3FrameInfo.nChans, mp3FrameInfo.samprate);
+                      write_result, frames, mp3FrameInfo[0].nChans, mp3FrameInfo[0].samprate);
                 goto error;
             }
-
         }
 
+        // 数据结束 (剩余数据不足一帧)
+        if (err == ERR_MP3_INDATA_UNDERFLOW)
+            break;
     }
 
     MP3FreeDecoder(hMP3Decoder);
@@ -0,0 +1,406 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * mp3adu.c - conversion between normal MP3 streams and self-contained frames (ADU's)
+ *
+ * An ADU (Application Data Unit, RFC 3119) is one frame's header and side info 
+ *  followed by exactly that frame's main data, wherever the bit reservoir had put 
+ *  it. Here main_data_begin is also set to 0, so each ADU is a "self-contained" 
+ *  frame which MP3Decode accepts with useSize = 1 and bytesLeft = ADU size. 
+ *  An ADU stream is a sequence of RFC 3119 ADU descriptors, each followed by its ADU.
+ *
+ * Converting back packs the main data of each ADU as early as the 9-bit (MPEG 1) or 
+ *  8-bit (MPEG 2) main_data_begin allows, into frames of the size given by each 
+ *  header. Unused bytes become zeroed ancillary data. This is not always the original 
+ *  byte stream, but it decodes to the same PCM.
+ **************************************************************************************/
+
+#include <string.h>
+#include "mp3common.h"	/* includes mp3dec.h (public API) and internal, platform-independent API */
+
+#define ADU_DESC_CONT		0x80	/* descriptor C flag: continuation of a fragmented ADU */
+#define ADU_DESC_LONG		0x40	/* descriptor T flag: 14-bit size in 2 bytes (else 6-bit size in 1 byte) */
+#define ADU_MAX_SIZE		0x3fff
+#define CRC16_POLY			0x8005
+#define ADU_MAX_BACK_FRAMES	32		/* frames the main data can reach back over (legal frames have > 16 slots) */
+
+/**************************************************************************************
+ * Function:    WriteADUDescriptor
+ *
+ * Description: write an RFC 3119 ADU descriptor (C flag clear - ADU's are never fragmented)
+ *
+ * Inputs:      buffer for descriptor, or 0 to just get its length
+ *              size of the ADU which follows, in bytes (< 2^14)
+ *
+ * Outputs:     1 or 2 byte descriptor, if buf != 0
+ *
+ * Return:      length of descriptor in bytes
+ **************************************************************************************/
+static int WriteADUDescriptor(unsigned char *buf, int aduSize)
+{
+	if (aduSize < ADU_DESC_LONG) {
+		if (buf)
+			buf[0] = (unsigned char)aduSize;
+		return 1;
+	}
+
+	if (buf) {
+		buf[0] = (unsigned char)(ADU_DESC_LONG | (aduSize >> 8));
+		buf[1] = (unsigned char)(aduSize & 0xff);
+	}
+	return 2;
+}
+
+/**************************************************************************************
+ * Function:    SetMainDataBegin
+ *
+ * Description: rewrite main_data_begin in the side info, and the CRC word if present
+ *
+ * Inputs:      complete frame header (4 bytes, plus 2 if CRC) followed by side info
+ *              length of frame header and side info, in bytes
+ *              new main_data_begin
+ *              MPEG version
+ *
+ * Outputs:     updated side info and CRC
+ *
+ * Return:      none
+ *
+ * Notes:       the CRC covers the last 2 bytes of the header and all of the side info
+ **************************************************************************************/
+static void SetMainDataBegin(unsigned char *frame, int fhBytes, int siBytes, int mainDataBegin, MPEGVersion version)
+{
+	int i, bit, crc;
+	unsigned char *si = frame + fhBytes;
+
+	if (version == MPEG1) {
+		/* 9 bits */
+		si[0] = (unsigned char)(mainDataBegin >> 1);
+		si[1] = (unsigned char)((si[1] & 0x7f) | ((mainDataBegin & 0x01) << 7));
+	} else {
+		/* 8 bits */
+		si[0] = (unsigned char)mainDataBegin;
+	}
+
+	if (fhBytes == 6) {
+		crc = 0xffff;
+		for (i = 2; i < fhBytes + siBytes; i++) {
+			if (i == 4)
+				i = 6;		/* skip the CRC word itself */
+			for (bit = 7; bit >= 0; bit--) {
+				if (((crc >> 15) ^ (frame[i] >> bit)) & 0x01)
+					crc = (crc << 1) ^ CRC16_POLY;
+				else
+					crc = (crc << 1);
+			}
+		}
+		frame[4] = (unsigned char)((crc >> 8) & 0xff);
+		frame[5] = (unsigned char)(crc & 0xff);
+	}
+}
+
+/**************************************************************************************
+ * Function:    MP3ReadADUDescriptor
+ *
+ * Description: parse the RFC 3119 ADU descriptor in front of each ADU
+ *
+ * Inputs:      buffer pointing to a descriptor
+ *              number of valid bytes in buffer
+ *
+ * Outputs:     size of the ADU which follows, in aduSize
+ *
+ * Return:      length of descriptor (1 or 2 bytes), or error code defined in mp3dec.h
+ *              ERR_MP3_INDATA_UNDERFLOW if the descriptor or the ADU is incomplete
+ *              ERR_MP3_INVALID_FRAMEHEADER if this is a fragment (C flag set), 
+ *                which is never produced by MP3ToADU - caller can skip it
+ *
+ * Notes:       to decode an ADU stream, call MP3Decode with useSize = 1 on each ADU, 
+ *                with bytesLeft = aduSize
+ **************************************************************************************/
+int MP3ReadADUDescriptor(unsigned char *buf, int nBytes, int *aduSize)
+{
+	int descBytes;
+
+	if (!buf || !aduSize)
+		return ERR_MP3_NULL_POINTER;
+
+	if (nBytes < 1)
+		return ERR_MP3_INDATA_UNDERFLOW;
+	if (buf[0] & ADU_DESC_LONG) {
+		if (nBytes < 2)
+			return ERR_MP3_INDATA_UNDERFLOW;
+		*aduSize = ((int)(buf[0] & 0x3f) << 8) | (int)buf[1];
+		descBytes = 2;
+	} else {
+		*aduSize = buf[0] & 0x3f;
+		descBytes = 1;
+	}
+
+	if (descBytes + *aduSize > nBytes)
+		return ERR_MP3_INDATA_UNDERFLOW;
+	if (buf[0] & ADU_DESC_CONT)
+		return ERR_MP3_INVALID_FRAMEHEADER;
+
+	return descBytes;
+}
+
+/**************************************************************************************
+ * Function:    MP3ToADU
+ *
+ * Description: convert a normal MP3 stream into an ADU stream of self-contained frames
+ *
+ * Inputs:      buffer holding the MP3 stream (normal MPEG format, from a frame boundary)
+ *              number of bytes in buffer
+ *              output buffer, or 0 to just query the size needed
+ *              size of output buffer in bytes
+ *
+ * Outputs:     ADU stream in aduBuf (descriptor + ADU per frame)
+ *              number of bytes written in aduBytes, or if aduBuf is 0 the size required
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_OUT_OF_MEMORY if aduBuf is too small or allocation fails
+ *
+ * Notes:       steps through the stream exactly like MP3DecodeFrames, and keeps the bit 
+ *                reservoir the same way MP3Decode does - frames which MP3Decode would 
+ *                reject for lack of main data (e.g. at the start of a cut stream) are 
+ *                dropped, everything else decodes to the same PCM as the input
+ *              free format frames are dropped too (the frame size can't be found 
+ *                from a self-contained frame)
+ *              only the main data goes with its frame, the IMDCT overlap and filterbank 
+ *                still need the frame before (decode one ADU and discard its output
+ *                after random access, for a sample-exact start)
+ **************************************************************************************/
+int MP3ToADU(unsigned char *buf, int nBytes, unsigned char *aduBuf, int aduBufSize, int *aduBytes)
+{
+	int offset, fhBytes, siBytes, err, bytesLeft, gr, ch, mainBits, mainBytes, nResv, nFromResv, nSlots, aduSize, total;
+	int freeFormat;
+	unsigned char *inbuf, *frameStart, *out;
+	unsigned char resv[MAINDATA_BEGIN_MAX];
+	MP3DecInfo *mp3DecInfo;
+
+	if (!buf || !aduBytes)
+		return ERR_MP3_NULL_POINTER;
+	*aduBytes = 0;
+
+	mp3DecInfo = (MP3DecInfo *)MP3InitDecoder();
+	if (!mp3DecInfo)
+		return ERR_MP3_OUT_OF_MEMORY;
+
+	total = 0;
+	nResv = 0;
+	inbuf = buf;
+	bytesLeft = nBytes;
+	while (bytesLeft > 0) {
+		offset = MP3FindSyncWord(inbuf, bytesLeft);
+		if (offset < 0)
+			break;
+		inbuf += offset;
+		bytesLeft -= offset;
+
+		frameStart = inbuf;
+		fhBytes = UnpackFrameHeader(mp3DecInfo, inbuf);
+		if (fhBytes < 0) {
+			inbuf++;
+			bytesLeft--;
+			continue;
+		}
+		freeFormat = (mp3DecInfo->bitrate == 0);
+		inbuf += fhBytes;
+		bytesLeft -= fhBytes;
+
+		err = UnpackFrameLayout(mp3DecInfo, &inbuf, &bytesLeft, fhBytes, 0);
+		if (err == ERR_MP3_INDATA_UNDERFLOW)
+			break;
+		else if (err)
+			continue;
+		siBytes = (int)(inbuf - frameStart) - fhBytes;
+		nSlots = mp3DecInfo->nSlots;
+
+		if (mp3DecInfo->mainDataBegin <= nResv) {
+			/* main data for this frame: the end of the reservoir, then the start of this frame's slots */
+			mainBits = 0;
+			for (gr = 0; gr < mp3DecInfo->nGrans; gr++)
+				for (ch = 0; ch < mp3DecInfo->nChans; ch++)
+					mainBits += mp3DecInfo->part23Length[gr][ch];
+			/* at least one byte, MP3Decode takes an empty self-contained frame as a lost one */
+			mainBytes = MIN(MAX((mainBits + 7) >> 3, 1), mp3DecInfo->mainDataBegin + nSlots);
+			nFromResv = MIN(mainBytes, mp3DecInfo->mainDataBegin);
+
+			aduSize = fhBytes + siBytes + mainBytes;
+			if (aduBuf && !freeFormat && total + WriteADUDescriptor(0, aduSize) + aduSize <= aduBufSize) {
+				out = aduBuf + total;
+				out += WriteADUDescriptor(out, aduSize);
+				memcpy(out, frameStart, fhBytes + siBytes);
+				SetMainDataBegin(out, fhBytes, siBytes, 0, mp3DecInfo->version);
+				out += fhBytes + siBytes;
+				memcpy(out, resv + nResv - mp3DecInfo->mainDataBegin, nFromResv);
+				memcpy(out + nFromResv, inbuf, mainBytes - nFromResv);
+			}
+			if (!freeFormat)
+				total += WriteADUDescriptor(0, aduSize) + aduSize;
+
+			/* only what this frame points back to stays in the reservoir, as in MP3Decode */
+			memmove(resv, resv + nResv - mp3DecInfo->mainDataBegin, mp3DecInfo->mainDataBegin);
+			nResv = mp3DecInfo->mainDataBegin;
+		}
+
+		/* append this frame's slots, keeping the last MAINDATA_BEGIN_MAX bytes */
+		if (nSlots >= MAINDATA_BEGIN_MAX) {
+			memcpy(resv, inbuf + nSlots - MAINDATA_BEGIN_MAX, MAINDATA_BEGIN_MAX);
+			nResv = MAINDATA_BEGIN_MAX;
+		} else {
+			offset = MAX(nResv + nSlots - MAINDATA_BEGIN_MAX, 0);
+			memmove(resv, resv + offset, nResv - offset);
+			memcpy(resv + nResv - offset, inbuf, nSlots);
+			nResv += nSlots - offset;
+		}
+
+		inbuf += nSlots;
+		bytesLeft -= nSlots;
+	}
+	MP3FreeDecoder(mp3DecInfo);
+
+	*aduBytes = total;
+	if (aduBuf && total > aduBufSize)
+		return ERR_MP3_OUT_OF_MEMORY;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3FromADU
+ *
+ * Description: convert an ADU stream back into a normal MP3 stream
+ *
+ * Inputs:      buffer holding the ADU stream (descriptor + ADU, as written by MP3ToADU)
+ *              number of bytes in buffer
+ *              output buffer, or 0 to just query the size needed
+ *              size of output buffer in bytes
+ *
+ * Outputs:     MP3 stream in buf, one frame per ADU
+ *              number of bytes written in nOutBytes, or if buf is 0 the size required
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_OUT_OF_MEMORY if buf is too small
+ *
+ * Notes:       ADU's with a bad header, fragments and free format frames are skipped 
+ *                (lost packets just leave a gap)
+ *              each frame's main data starts as far back as possible, so any ADU 
+ *                stream made from a normal stream fits - if not (corrupt input), 
+ *                the main data is cut short and that frame fails to decode
+ **************************************************************************************/
+int MP3FromADU(unsigned char *aduBuf, int nBytes, unsigned char *buf, int bufSize, int *nOutBytes)
+{
+	int i, n, descBytes, aduSize, fhBytes, siBytes, mainBytes, maxBegin, total;
+	int slotPos, mainStart, mainEnd, pos, len, nFrames;
+	int slotOffset[ADU_MAX_BACK_FRAMES], slotLogical[ADU_MAX_BACK_FRAMES];
+	unsigned char *adu, *mainData;
+	MP3DecInfo *mp3DecInfo;
+
+	if (!aduBuf || !nOutBytes)
+		return ERR_MP3_NULL_POINTER;
+	*nOutBytes = 0;
+
+	mp3DecInfo = (MP3DecInfo *)MP3InitDecoder();
+	if (!mp3DecInfo)
+		return ERR_MP3_OUT_OF_MEMORY;
+
+	/* main data positions count only slot bytes (the bit reservoir skips headers and side info) 
+	 *   slotOffset/slotLogical map the slots of the last few frames back to offsets in buf
+	 */
+	total = 0;
+	slotPos = 0;
+	mainEnd = 0;
+	nFrames = 0;
+	while (nBytes > 0) {
+		descBytes = MP3ReadADUDescriptor(aduBuf, nBytes, &aduSize);
+		if (descBytes == ERR_MP3_INDATA_UNDERFLOW)
+			break;
+		adu = aduBuf + MAX(descBytes, 0);
+		aduBuf += MAX(descBytes, 0) + aduSize;
+		nBytes -= MAX(descBytes, 0) + aduSize;
+		if (descBytes < 0 || aduSize < 4 || MP3FindSyncWord(adu, aduSize) != 0)
+			continue;
+
+		fhBytes = UnpackFrameHeader(mp3DecInfo, adu);
+		if (fhBytes < 0 || mp3DecInfo->bitrate == 0 || fhBytes >= aduSize)
+			continue;
+		siBytes = UnpackSideInfo(mp3DecInfo, adu + fhBytes);
+		if (siBytes < 0 || fhBytes + siBytes > aduSize)
+			continue;
+		mainData = adu + fhBytes + siBytes;
+		mainBytes = aduSize - fhBytes - siBytes;
+		maxBegin = (mp3DecInfo->version == MPEG1 ? MAINDATA_BEGIN_MAX : 255);
+
+		i = nFrames % ADU_MAX_BACK_FRAMES;
+		slotOffset[i] = total + fhBytes + siBytes;
+		slotLogical[i] = slotPos;
+		nFrames++;
+
+		/* main data goes right after the previous frame's, unless that's more than maxBegin bytes back */
+		mainStart = MAX(mainEnd, slotPos - maxBegin);
+		if (nFrames > ADU_MAX_BACK_FRAMES)
+			mainStart = MAX(mainStart, slotLogical[nFrames % ADU_MAX_BACK_FRAMES]);
+		mainEnd = MIN(mainStart + mainBytes, slotPos + mp3DecInfo->nSlots);
+
+		if (buf && total + fhBytes + siBytes + mp3DecInfo->nSlots <= bufSize) {
+			memcpy(buf + total, adu, fhBytes + siBytes);
+			SetMainDataBegin(buf + total, fhBytes, siBytes, slotPos - mainStart, mp3DecInfo->version);
+			memset(buf + slotOffset[i], 0, mp3DecInfo->nSlots);
+
+			/* copy into the slots of this and earlier frames, oldest first */
+			n = MAX(nFrames - ADU_MAX_BACK_FRAMES, 0);
+			for (pos = mainStart; pos < mainEnd; pos += len) {
+				while (n + 1 < nFrames && slotLogical[(n + 1) % ADU_MAX_BACK_FRAMES] <= pos)
+					n++;
+				len = (n + 1 < nFrames ? MIN(slotLogical[(n + 1) % ADU_MAX_BACK_FRAMES], mainEnd) : mainEnd) - pos;
+				memcpy(buf + slotOffset[n % ADU_MAX_BACK_FRAMES] + pos - slotLogical[n % ADU_MAX_BACK_FRAMES], mainData, len);
+				mainData += len;
+			}
+		}
+		total += fhBytes + siBytes + mp3DecInfo->nSlots;
+		slotPos += mp3DecInfo->nSlots;
+	}
+	MP3FreeDecoder(mp3DecInfo);
+
+	*nOutBytes = total;
+	if (buf && total > bufSize)
+		return ERR_MP3_OUT_OF_MEMORY;
+
+	return ERR_MP3_NONE;
+}
@@ -46,16 +46,15 @@
 #include "mp3common.h"	/* includes mp3dec.h (public API) and internal, platform-independent API */
 
 
-//#define PROFILE
-#ifdef PROFILE
-#include "systime.h"
-#endif
+/* outbuf is short *, but holds ints (two shorts per sample) for 24/32-bit output */
+#define PCM_WORDS(mp3DecInfo)	((mp3DecInfo)->bitsPerSample > 16 ? 2 : 1)
 
 /**************************************************************************************
  * Function:    MP3InitDecoder
  *
  * Description: allocate memory for platform-specific data
  *              clear all the user-accessible fields
+ *              detect which SIMD kernels (if any) this CPU can run
  *
  * Inputs:      none
  *
@@ -68,6 +67,8 @@ HMP3Decoder MP3InitDecoder(void)
 	MP3DecInfo *mp3DecInfo;
 
 	mp3DecInfo = AllocateBuffers();
+	if (mp3DecInfo)
+		mp3DecInfo->simdCaps = GetSIMDCaps();
 
 	return (HMP3Decoder)mp3DecInfo;
 }
@@ -76,7 +77,7 @@ HMP3Decoder MP3InitDecoder(void)
  * Function:    MP3FreeDecoder
  *
  * Description: free platform-specific data allocated by InitMP3Decoder
- *              zero out the contents of MP3DecInfo struct
+ *              (no-op for decoders created with MP3InitDecoderInPlace)
  *
  * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
  *
@@ -91,9 +92,407 @@ void MP3FreeDecoder(HMP3Decoder hMP3Decoder)
 	if (!mp3DecInfo)
 		return;
 
+	PipelineDestroy(mp3DecInfo);
 	FreeBuffers(mp3DecInfo);
 }
 
+/**************************************************************************************
+ * Function:    MP3GetDecoderSize
+ *
+ * Description: number of bytes of memory needed by MP3InitDecoderInPlace
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      size in bytes (same for every decoder instance, includes alignment slack
+ *                so any pointer may be passed to MP3InitDecoderInPlace)
+ **************************************************************************************/
+int MP3GetDecoderSize(void)
+{
+	return GetBufferSize();
+}
+
+/**************************************************************************************
+ * Function:    MP3InitDecoderInPlace
+ *
+ * Description: like MP3InitDecoder, but places all decoder state in caller memory
+ *                (one contiguous, cache-line-aligned block - no malloc)
+ *
+ * Inputs:      pointer to memory for decoder
+ *              size of memory in bytes, at least MP3GetDecoderSize()
+ *
+ * Outputs:     none
+ *
+ * Return:      handle to mp3 decoder instance, 0 if mem is null or too small
+ *
+ * Notes:       mem must stay valid while the decoder is in use, and is never freed 
+ *                by the decoder (MP3FreeDecoder does nothing for these instances)
+ **************************************************************************************/
+HMP3Decoder MP3InitDecoderInPlace(void *mem, int nBytes)
+{
+	MP3DecInfo *mp3DecInfo;
+
+	mp3DecInfo = InitBuffers(mem, nBytes);
+	if (mp3DecInfo)
+		mp3DecInfo->simdCaps = GetSIMDCaps();
+
+	return (HMP3Decoder)mp3DecInfo;
+}
+
+/**************************************************************************************
+ * Function:    MP3ResetDecoder
+ *
+ * Description: clear all decoder state (bit reservoir, overlap and filterbank history)
+ *                without freeing, e.g. before starting a new stream or after a seek
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *
+ * Outputs:     none
+ *
+ * Return:      none
+ **************************************************************************************/
+void MP3ResetDecoder(HMP3Decoder hMP3Decoder)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return;
+
+	if (mp3DecInfo->PipelinePS)
+		PipelineFlush(mp3DecInfo);
+	ResetBuffers(mp3DecInfo);
+}
+
+/**************************************************************************************
+ * Function:    MP3SetPlanarOutput
+ *
+ * Description: choose between interleaved (LRLRLR...) and planar (LLL... RRR...) PCM
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              1 for planar output, 0 for interleaved (default)
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       where the right channel goes is described with each decode function
+ *              kept across MP3ResetDecoder
+ **************************************************************************************/
+int MP3SetPlanarOutput(HMP3Decoder hMP3Decoder, int planar)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	mp3DecInfo->planar = (planar ? 1 : 0);
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetOutputBits
+ *
+ * Description: choose the PCM sample format
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              16 for shorts (default), 24 or 32 for right-justified ints (S24 in a 
+ *                32-bit container, or S32)
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_INVALID_PARAM for any other bitsPerSample
+ *
+ * Notes:       24/32-bit samples come straight from the 64-bit polyphase sums, 
+ *                without narrowing to 16 bits first (full scale = 2^(bitsPerSample-1))
+ *              outbuf is still passed as short *, but must be int aligned and sized in 
+ *                ints; MP3FrameInfo.bitsPerSample reports the setting
+ *              kept across MP3ResetDecoder
+ **************************************************************************************/
+int MP3SetOutputBits(HMP3Decoder hMP3Decoder, int bitsPerSample)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	if (bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32)
+		return ERR_MP3_INVALID_PARAM;
+
+	mp3DecInfo->bitsPerSample = bitsPerSample;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetChannelMode
+ *
+ * Description: choose which channels to decode
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              MP3_CHANNELS_ALL (default), MP3_CHANNELS_LEFT, MP3_CHANNELS_RIGHT, 
+ *                or MP3_CHANNELS_MIX
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_INVALID_PARAM for an unknown mode
+ *
+ * Notes:       in all modes but MP3_CHANNELS_ALL, stereo streams decode to mono and 
+ *                MP3FrameInfo reports nChans = 1 (mono streams are not affected)
+ *              LEFT/RIGHT: the other channel skips IMDCT and synthesis, and also 
+ *                Huffman decoding and dequantization unless the frame uses 
+ *                mid-side or intensity stereo
+ *              MIX: both channels go through IMDCT (each keeps its own overlap, as 
+ *                block types can differ), one goes through synthesis
+ *              switching mode mid-stream can glitch the channel which was not being
+ *                decoded for a granule or two
+ *              kept across MP3ResetDecoder
+ **************************************************************************************/
+int MP3SetChannelMode(HMP3Decoder hMP3Decoder, MP3ChannelMode channelMode)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	if (channelMode < MP3_CHANNELS_ALL || channelMode > MP3_CHANNELS_MIX)
+		return ERR_MP3_INVALID_PARAM;
+
+	mp3DecInfo->channelMode = channelMode;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetDecimation
+ *
+ * Description: choose full, half, or quarter rate output
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              1 (default), 2, or 4 - output sample rate is the stream's divided by this
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_INVALID_PARAM for any other factor
+ *
+ * Notes:       only the lowest 32/factor subbands go through IMDCT, and the polyphase 
+ *                filterbank only computes every factor'th output sample, so the output
+ *                is band-limited to samprate/(2*factor) with no extra filtering
+ *              MP3FrameInfo samprate and outputSamps report the reduced rate; 
+ *                per-granule offsets (planar layout, MP3DecodeGranules) shrink to match
+ *              kept across MP3ResetDecoder
+ **************************************************************************************/
+int MP3SetDecimation(HMP3Decoder hMP3Decoder, int factor)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	if (factor != 1 && factor != 2 && factor != 4)
+		return ERR_MP3_INVALID_PARAM;
+
+	mp3DecInfo->decimate = factor;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetStageStats
+ *
+ * Description: turn per-stage timing on or off
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              1 to start timing (counters are cleared), 0 to stop
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       costs one test per stage while off, and two clock reads per stage
+ *                while on (see GetStageClock)
+ *              in pipelined mode IMDCT and subband time is measured on the 
+ *                synthesis thread
+ *              counters are kept across MP3ResetDecoder
+ **************************************************************************************/
+int MP3SetStageStats(HMP3Decoder hMP3Decoder, int enable)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	if (enable) {
+		memset(&mp3DecInfo->stats, 0, sizeof(MP3StageStats));
+		mp3DecInfo->stageStats = &mp3DecInfo->stats;
+	} else {
+		mp3DecInfo->stageStats = 0;
+	}
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3GetStageStats
+ *
+ * Description: read the per-stage timing counters
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              pointer to MP3StageStats struct
+ *
+ * Outputs:     time and number of calls for each MP3Stage, accumulated since stats
+ *                were last enabled (still valid after they are turned off)
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       call between decode calls, from the decoding thread
+ **************************************************************************************/
+int MP3GetStageStats(HMP3Decoder hMP3Decoder, MP3StageStats *stageStats)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo || !stageStats)
+		return ERR_MP3_NULL_POINTER;
+
+	*stageStats = mp3DecInfo->stats;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3GetStateSize
+ *
+ * Description: buffer size needed by MP3SaveState
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      max size in bytes of a decoder state blob (about 7 KB, mono streams
+ *                and quiet passages need much less)
+ **************************************************************************************/
+int MP3GetStateSize(void)
+{
+	return GetStateSize();
+}
+
+/**************************************************************************************
+ * Function:    MP3SaveState
+ *
+ * Description: snapshot everything the next frame depends on
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              buffer for the state blob, and its size in bytes (MP3GetStateSize() 
+ *                is always enough)
+ *
+ * Outputs:     state blob in buf, its size in stateBytes
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_INVALID_PARAM if buf is too small
+ *
+ * Notes:       call between frames (e.g. right after MP3Decode at a loop point) and 
+ *                store the input position of the next frame alongside the blob
+ *              the blob holds the bit reservoir, IMDCT overlap and polyphase filter 
+ *                history, so decoding resumes sample-exact with no pre-roll
+ *              not portable between builds or machines (native byte order)
+ **************************************************************************************/
+int MP3SaveState(HMP3Decoder hMP3Decoder, unsigned char *buf, int bufSize, int *stateBytes)
+{
+	int nBytes;
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo || !buf || !stateBytes)
+		return ERR_MP3_NULL_POINTER;
+
+	if (mp3DecInfo->PipelinePS)
+		PipelineFlush(mp3DecInfo);
+
+	nBytes = SaveState(mp3DecInfo, buf, bufSize);
+	if (nBytes < 0)
+		return ERR_MP3_INVALID_PARAM;
+	*stateBytes = nBytes;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3RestoreState
+ *
+ * Description: resume decoding from a snapshot taken with MP3SaveState
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              state blob and its size in bytes
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_INVALID_PARAM if the blob is damaged or from another build
+ *                (decoder is left unchanged)
+ *
+ * Notes:       then decode from the frame which followed the snapshot, the output 
+ *                is identical to what the saving decoder produced from there
+ *              any decoder instance can restore any snapshot; output settings 
+ *                (MP3SetPlanarOutput etc.) are not part of the state
+ **************************************************************************************/
+int MP3RestoreState(HMP3Decoder hMP3Decoder, const unsigned char *buf, int stateBytes)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo || !buf)
+		return ERR_MP3_NULL_POINTER;
+
+	if (mp3DecInfo->PipelinePS)
+		PipelineFlush(mp3DecInfo);
+
+	if (RestoreState(mp3DecInfo, buf, stateBytes) < 0)
+		return ERR_MP3_INVALID_PARAM;
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    MP3SetPipelined
+ *
+ * Description: turn two-stage pipelined decoding on or off
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              1 to run IMDCT + subband transform on a second thread, 0 for serial
+ *
+ * Outputs:     none
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_OUT_OF_MEMORY if the synthesis thread could not be started 
+ *                (decoder stays serial)
+ *
+ * Notes:       entropy decoding and dequantization of each granule overlap the
+ *                synthesis of the one before it: within a frame in MP3Decode, and 
+ *                across frames in MP3DecodeFrames (best for single-stream players)
+ *              output is identical in both modes
+ *              MP3FreeDecoder stops the thread; for MP3InitDecoderInPlace decoders, call
+ *                MP3SetPipelined(h, 0) before the buffer is reused
+ **************************************************************************************/
+int MP3SetPipelined(HMP3Decoder hMP3Decoder, int enable)
+{
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	if (!enable) {
+		PipelineDestroy(mp3DecInfo);
+		return ERR_MP3_NONE;
+	}
+
+	if (!mp3DecInfo->PipelinePS && PipelineCreate(mp3DecInfo) < 0)
+		return ERR_MP3_OUT_OF_MEMORY;
+
+	return ERR_MP3_NONE;
+}
+
 /**************************************************************************************
  * Function:    MP3FindSyncWord
  *
@@ -172,6 +571,32 @@ static int MP3FindFreeSync(unsigned char *buf, unsigned char firstFH[4], int nBy
 	return -1;
 }
 
+/**************************************************************************************
+ * Function:    FrameHeaderSideBytes
+ *
+ * Description: get the number of bytes DecodeFrame parses before it knows how long
+ *                the frame is (header, CRC word, side info)
+ *
+ * Inputs:      buffer pointing to the first 4 bytes of an MP3 frame header
+ *
+ * Outputs:     none
+ *
+ * Return:      length of header + CRC + side info, in bytes
+ *
+ * Notes:       only reads the version, CRC and mode fields (same bitmasks as 
+ *                UnpackFrameHeader), header is not validated here
+ **************************************************************************************/
+static int FrameHeaderSideBytes(unsigned char *buf)
+{
+	int verIdx, ver;
+
+	verIdx = (buf[1] >> 3) & 0x03;
+	ver = (verIdx == 0 ? MPEG25 : ((verIdx & 0x01) ? MPEG1 : MPEG2));
+
+	/* protection bit clear = 16-bit CRC follows the header, mode 3 = mono */
+	return 4 + ((buf[1] & 0x01) ? 0 : 2) + (int)sideBytesTab[ver][(((buf[3] >> 6) & 0x03) == 0x03 ? 0 : 1)];
+}
+
 /**************************************************************************************
  * Function:    MP3GetLastFrameInfo
  *
@@ -201,10 +626,10 @@ void MP3GetLastFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo)
 		mp3FrameInfo->version = 0;
 	} else {
 		mp3FrameInfo->bitrate = mp3DecInfo->bitrate;
-		mp3FrameInfo->nChans = mp3DecInfo->nChans;
-		mp3FrameInfo->samprate = mp3DecInfo->samprate;
-		mp3FrameInfo->bitsPerSample = 16;
-		mp3FrameInfo->outputSamps = mp3DecInfo->nChans * (int)samplesPerFrameTab[mp3DecInfo->version][mp3DecInfo->layer - 1];
+		mp3FrameInfo->nChans = OUT_CHANS(mp3DecInfo);
+		mp3FrameInfo->samprate = mp3DecInfo->samprate / mp3DecInfo->decimate;
+		mp3FrameInfo->bitsPerSample = mp3DecInfo->bitsPerSample;
+		mp3FrameInfo->outputSamps = OUT_CHANS(mp3DecInfo) * (int)samplesPerFrameTab[mp3DecInfo->version][mp3DecInfo->layer - 1] / mp3DecInfo->decimate;
 		mp3FrameInfo->layer = mp3DecInfo->layer;
 		mp3FrameInfo->version = mp3DecInfo->version;
 	}
@@ -253,72 +678,90 @@ int MP3GetNextFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo, uns
  **************************************************************************************/
 static void MP3ClearBadFrame(MP3DecInfo *mp3DecInfo, short *outbuf)
 {
-	int i;
+	int i, ch;
 
 	if (!mp3DecInfo)
 		return;
 
-	for (i = 0; i < mp3DecInfo->nGrans * mp3DecInfo->nGranSamps * mp3DecInfo->nChans; i++)
+	/* granules already handed to the synthesis thread must not land after the clear */
+	if (mp3DecInfo->PipelinePS)
+		PipelineFlush(mp3DecInfo);
+
+	if (mp3DecInfo->chanStride) {
+		/* planar */
+		for (ch = 0; ch < OUT_CHANS(mp3DecInfo); ch++) {
+			for (i = 0; i < mp3DecInfo->nGrans * OUT_GRAN_SAMPS(mp3DecInfo) * PCM_WORDS(mp3DecInfo); i++)
+				outbuf[ch * mp3DecInfo->chanStride * PCM_WORDS(mp3DecInfo) + i] = 0;
+		}
+		return;
+	}
+
+	for (i = 0; i < mp3DecInfo->nGrans * OUT_GRAN_SAMPS(mp3DecInfo) * OUT_CHANS(mp3DecInfo) * PCM_WORDS(mp3DecInfo); i++)
 		outbuf[i] = 0;
 }
 
 /**************************************************************************************
- * Function:    MP3Decode
+ * Function:    AppendMainData
  *
- * Description: decode one frame of MP3 data
+ * Description: append main_data to the sliding window in mainBuf
  *
- * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
- *              double pointer to buffer of MP3 data (containing headers + mainData)
+ * Inputs:      MP3DecInfo struct with valid mainDataStart and mainDataBytes
+ *              pointer to new main_data
+ *              number of bytes to append (must be <= MAINBUF_WINDOW - MAINDATA_BEGIN_MAX)
+ *
+ * Outputs:     updated mainBuf, mainDataStart, mainDataBytes
+ *
+ * Return:      none
+ *
+ * Notes:       data is only moved when the end of the window is reached, and then
+ *                only the newest MAINDATA_BEGIN_MAX bytes (all that a later frame can 
+ *                reference) are kept, so each input byte is copied about once
+ **************************************************************************************/
+static void AppendMainData(MP3DecInfo *mp3DecInfo, unsigned char *buf, int nBytes)
+{
+	int nKeep;
+
+	if (mp3DecInfo->mainDataStart + mp3DecInfo->mainDataBytes + nBytes > MAINBUF_WINDOW) {
+		nKeep = MIN(mp3DecInfo->mainDataBytes, MAINDATA_BEGIN_MAX);
+		memmove(mp3DecInfo->mainBuf, mp3DecInfo->mainBuf + mp3DecInfo->mainDataStart + mp3DecInfo->mainDataBytes - nKeep, nKeep);
+		mp3DecInfo->mainDataStart = 0;
+		mp3DecInfo->mainDataBytes = nKeep;
+	}
+	memcpy(mp3DecInfo->mainBuf + mp3DecInfo->mainDataStart + mp3DecInfo->mainDataBytes, buf, nBytes);
+	mp3DecInfo->mainDataBytes += nBytes;
+}
+
+/**************************************************************************************
+ * Function:    UnpackFrameLayout
+ *
+ * Description: unpack side info and find the size of the main data in this frame,
+ *                without touching the bit reservoir
+ *
+ * Inputs:      MP3DecInfo struct with frame header just unpacked
+ *              double pointer to buffer of MP3 data (just after the frame header)
  *              number of valid bytes remaining in inbuf
- *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
- *              flag indicating whether MP3 data is normal MPEG format (useSize = 0)
- *                or reformatted as "self-contained" frames (useSize = 1)
+ *              number of bytes in frame header (including CRC)
+ *              useSize flag (see MP3Decode)
  *
- * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
- *                number of output samples = nGrans * nGranSamps * nChans
- *              updated inbuf pointer, updated bytesLeft
+ * Outputs:     filled side info, mainDataBegin and nSlots
+ *              inbuf and bytesLeft advanced past the side info (if it was valid)
  *
  * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
  *
- * Notes:       switching useSize on and off between frames in the same stream 
- *                is not supported (bit reservoir is not maintained if useSize on)
+ * Notes:       on success the caller takes the next nSlots bytes as main data
+ *              also used by MP3DecodeParallel to index frames exactly the way 
+ *                MP3Decode steps through them
  **************************************************************************************/
-int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
+int UnpackFrameLayout(MP3DecInfo *mp3DecInfo, unsigned char **inbuf, int *bytesLeft, int fhBytes, int useSize)
 {
-	int offset, bitOffset, mainBits, gr, ch, fhBytes, siBytes, freeFrameBytes;
-	int prevBitOffset, sfBlockBits, huffBlockBits;
-	unsigned char *mainPtr;
-	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
-	
-	#ifdef PROFILE
-	long time;
-	#endif
-
-	if (!mp3DecInfo)
-		return ERR_MP3_NULL_POINTER;
+	int siBytes, freeFrameBytes;
 
-	/* unpack frame header */
-	fhBytes = UnpackFrameHeader(mp3DecInfo, *inbuf);
-	if (fhBytes < 0)	
-		return ERR_MP3_INVALID_FRAMEHEADER;		/* don't clear outbuf since we don't know size (failed to parse header) */
-	*inbuf += fhBytes;
-	
-#ifdef PROFILE
-	time = systime_get();
-#endif
 	/* unpack side info */
 	siBytes = UnpackSideInfo(mp3DecInfo, *inbuf);
-	if (siBytes < 0) {
-		MP3ClearBadFrame(mp3DecInfo, outbuf);
+	if (siBytes < 0)
 		return ERR_MP3_INVALID_SIDEINFO;
-	}
 	*inbuf += siBytes;
-	*bytesLeft -= (fhBytes + siBytes);
-#ifdef PROFILE
-	time = systime_get() - time;
-	printf("UnpackSideInfo: %i ms\n", time);
-#endif
-	
+	*bytesLeft -= siBytes;
 	
 	/* if free mode, need to calculate bitrate and nSlots manually, based on frame size */
 	if (mp3DecInfo->bitrate == 0 || mp3DecInfo->freeBitrateFlag) {
@@ -326,10 +769,8 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 			/* first time through, need to scan for next sync word and figure out frame size */
 			mp3DecInfo->freeBitrateFlag = 1;
 			mp3DecInfo->freeBitrateSlots = MP3FindFreeSync(*inbuf, *inbuf - fhBytes - siBytes, *bytesLeft);
-			if (mp3DecInfo->freeBitrateSlots < 0) {
-				MP3ClearBadFrame(mp3DecInfo, outbuf);
+			if (mp3DecInfo->freeBitrateSlots < 0)
 				return ERR_MP3_FREE_BITRATE_SYNC;
-			}
 			freeFrameBytes = mp3DecInfo->freeBitrateSlots + fhBytes + siBytes;
 			mp3DecInfo->bitrate = (freeFrameBytes * mp3DecInfo->samprate * 8) / (mp3DecInfo->nGrans * mp3DecInfo->nGranSamps);
 		}
@@ -346,67 +787,123 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 		mp3DecInfo->nSlots = *bytesLeft;
 		if (mp3DecInfo->mainDataBegin != 0 || mp3DecInfo->nSlots <= 0) {
 			/* error - non self-contained frame, or missing frame (size <= 0), could do loss concealment here */
-			MP3ClearBadFrame(mp3DecInfo, outbuf);
 			return ERR_MP3_INVALID_FRAMEHEADER;
 		}
+	} else {
+		/* out of data - assume last or truncated frame */
+		if (mp3DecInfo->nSlots > *bytesLeft)
+			return ERR_MP3_INDATA_UNDERFLOW;	
+
+		/* larger than any legal frame (free format only), would not fit in the main data window */
+		if (mp3DecInfo->nSlots > MAINBUF_WINDOW - MAINDATA_BEGIN_MAX)
+			return ERR_MP3_INVALID_FRAMEHEADER;
+	}
+
+	return ERR_MP3_NONE;
+}
+
+/**************************************************************************************
+ * Function:    DecodeFrame
+ *
+ * Description: decode one frame of MP3 data (see MP3Decode)
+ *
+ * Inputs:      same as MP3Decode
+ *
+ * Outputs:     same as MP3Decode, except that in pipelined mode the last granules 
+ *                may still be in the synthesis thread on return (see PipelineFlush)
+ *              if mp3DecInfo->chanStride != 0 the PCM is planar, with channel 1 
+ *                starting chanStride samples after channel 0
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ **************************************************************************************/
+static int DecodeFrame(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
+{
+	int offset, bitOffset, mainBits, gr, ch, fhBytes, err;
+	int prevBitOffset, sfBlockBits, huffBlockBits, mainBytes, nKeep;
+	unsigned char *mainPtr;
+	short *pcmBuf;
+	MP3Counter t0;
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
 
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	/* unpack frame header */
+	t0 = STAGE_START(mp3DecInfo);
+	fhBytes = UnpackFrameHeader(mp3DecInfo, *inbuf);
+	if (fhBytes < 0)	
+		return ERR_MP3_INVALID_FRAMEHEADER;		/* don't clear outbuf since we don't know size (failed to parse header) */
+	*inbuf += fhBytes;
+	*bytesLeft -= fhBytes;
+
+	/* unpack side info, work out where this frame's main data ends */
+	err = UnpackFrameLayout(mp3DecInfo, inbuf, bytesLeft, fhBytes, useSize);
+	STAGE_END(mp3DecInfo, MP3_STAGE_SIDEINFO, t0);
+	if (err) {
+		MP3ClearBadFrame(mp3DecInfo, outbuf);
+		return err;
+	}
+
+	if (useSize) {
 		/* can operate in-place on reformatted frames */
 		mp3DecInfo->mainDataBytes = mp3DecInfo->nSlots;
+		mainBytes = mp3DecInfo->nSlots;
 		mainPtr = *inbuf;
 		*inbuf += mp3DecInfo->nSlots;
 		*bytesLeft -= (mp3DecInfo->nSlots);
 	} else {
-		/* out of data - assume last or truncated frame */
-		if (mp3DecInfo->nSlots > *bytesLeft) {
-			MP3ClearBadFrame(mp3DecInfo, outbuf);
-			return ERR_MP3_INDATA_UNDERFLOW;	
-		}
-
-#ifdef PROFILE
-	time = systime_get();
-#endif
+		t0 = STAGE_START(mp3DecInfo);
 		/* fill main data buffer with enough new data for this frame */
 		if (mp3DecInfo->mainDataBytes >= mp3DecInfo->mainDataBegin) {
 			/* adequate "old" main data available (i.e. bit reservoir) */
-			memmove(mp3DecInfo->mainBuf, mp3DecInfo->mainBuf + mp3DecInfo->mainDataBytes - mp3DecInfo->mainDataBegin, mp3DecInfo->mainDataBegin);
-			memcpy(mp3DecInfo->mainBuf + mp3DecInfo->mainDataBegin, *inbuf, mp3DecInfo->nSlots);
-
-			mp3DecInfo->mainDataBytes = mp3DecInfo->mainDataBegin + mp3DecInfo->nSlots;
+			if (mp3DecInfo->mainDataBegin == 0) {
+				/* no bit reservoir used - decode straight from inbuf, and only save the 
+				 *   tail of this frame which later frames can reference with mainDataBegin 
+				 */
+				mainPtr = *inbuf;
+				nKeep = MIN(mp3DecInfo->nSlots, MAINDATA_BEGIN_MAX);
+				memcpy(mp3DecInfo->mainBuf, *inbuf + mp3DecInfo->nSlots - nKeep, nKeep);
+				mp3DecInfo->mainDataStart = 0;
+				mp3DecInfo->mainDataBytes = nKeep;
+			} else {
+				/* drop everything older than the bit reservoir and append new data */
+				mp3DecInfo->mainDataStart += mp3DecInfo->mainDataBytes - mp3DecInfo->mainDataBegin;
+				mp3DecInfo->mainDataBytes = mp3DecInfo->mainDataBegin;
+				AppendMainData(mp3DecInfo, *inbuf, mp3DecInfo->nSlots);
+				mainPtr = mp3DecInfo->mainBuf + mp3DecInfo->mainDataStart;
+			}
+			mainBytes = mp3DecInfo->mainDataBegin + mp3DecInfo->nSlots;
 			*inbuf += mp3DecInfo->nSlots;
 			*bytesLeft -= (mp3DecInfo->nSlots);
-			mainPtr = mp3DecInfo->mainBuf;
 		} else {
 			/* not enough data in bit reservoir from previous frames (perhaps starting in middle of file) */
-			memcpy(mp3DecInfo->mainBuf + mp3DecInfo->mainDataBytes, *inbuf, mp3DecInfo->nSlots);
-			mp3DecInfo->mainDataBytes += mp3DecInfo->nSlots;
+			AppendMainData(mp3DecInfo, *inbuf, mp3DecInfo->nSlots);
 			*inbuf += mp3DecInfo->nSlots;
 			*bytesLeft -= (mp3DecInfo->nSlots);
+			STAGE_END(mp3DecInfo, MP3_STAGE_MAINDATA, t0);
 			MP3ClearBadFrame(mp3DecInfo, outbuf);
 			return ERR_MP3_MAINDATA_UNDERFLOW;
 		}
-#ifdef PROFILE
-	time = systime_get() - time;
-	printf("data buffer filling: %i ms\n", time);
-#endif
-
+		STAGE_END(mp3DecInfo, MP3_STAGE_MAINDATA, t0);
 	}
 	bitOffset = 0;
-	mainBits = mp3DecInfo->mainDataBytes * 8;
+	mainBits = mainBytes * 8;
 
-	/* decode one complete frame */
+	/* decode one complete frame
+	 *   (no per-format copies of this loop: the version, channel count and stereo mode tests here 
+	 *    and in Dequantize/IMDCT/Subband run once per granule or channel, never per sample)
+	 */
 	for (gr = 0; gr < mp3DecInfo->nGrans; gr++) {
+		/* pipelined: decode straight into a free slot of the synthesis queue */
+		if (mp3DecInfo->PipelinePS)
+			PipelineBeginGranule(mp3DecInfo);
+
 		for (ch = 0; ch < mp3DecInfo->nChans; ch++) {
-			
-			#ifdef PROFILE
-				time = systime_get();
-			#endif
 			/* unpack scale factors and compute size of scale factor block */
+			t0 = STAGE_START(mp3DecInfo);
 			prevBitOffset = bitOffset;
 			offset = UnpackScaleFactors(mp3DecInfo, mainPtr, &bitOffset, mainBits, gr, ch);
-			#ifdef PROFILE
-				time = systime_get() - time;
-				printf("UnpackScaleFactors: %i ms\n", time);
-			#endif
+			STAGE_END(mp3DecInfo, MP3_STAGE_SCALEFACT, t0);
 
 			sfBlockBits = 8*offset - prevBitOffset + bitOffset;
 			huffBlockBits = mp3DecInfo->part23Length[gr][ch] - sfBlockBits;
@@ -418,67 +915,271 @@ int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, sh
 				return ERR_MP3_INVALID_SCALEFACT;
 			}
 
-			#ifdef PROFILE
-				time = systime_get();
-			#endif
 			/* decode Huffman code words */
+			t0 = STAGE_START(mp3DecInfo);
 			prevBitOffset = bitOffset;
 			offset = DecodeHuffman(mp3DecInfo, mainPtr, &bitOffset, huffBlockBits, gr, ch);
+			STAGE_END(mp3DecInfo, MP3_STAGE_HUFFMAN, t0);
 			if (offset < 0) {
 				MP3ClearBadFrame(mp3DecInfo, outbuf);
 				return ERR_MP3_INVALID_HUFFCODES;
 			}
-			#ifdef PROFILE
-				time = systime_get() - time;
-				printf("Huffman: %i ms\n", time);
-			#endif
 
 			mainPtr += offset;
 			mainBits -= (8*offset - prevBitOffset + bitOffset);
 		}
 		
-		#ifdef PROFILE
-			time = systime_get();
-		#endif
 		/* dequantize coefficients, decode stereo, reorder short blocks */
-		if (Dequantize(mp3DecInfo, gr) < 0) {
+		t0 = STAGE_START(mp3DecInfo);
+		err = Dequantize(mp3DecInfo, gr);
+		STAGE_END(mp3DecInfo, MP3_STAGE_DEQUANT, t0);
+		if (err < 0) {
 			MP3ClearBadFrame(mp3DecInfo, outbuf);
 			return ERR_MP3_INVALID_DEQUANTIZE;			
 		}
-		#ifdef PROFILE
-			time = systime_get() - time;
-			printf("Dequantize: %i ms\n", time);
-		#endif
+
+		/* start of this granule's PCM (of channel 0, if planar) */
+		pcmBuf = outbuf + gr*OUT_GRAN_SAMPS(mp3DecInfo)*(mp3DecInfo->chanStride ? 1 : OUT_CHANS(mp3DecInfo))*PCM_WORDS(mp3DecInfo);
+
+		/* pipelined: IMDCT and subband transform run on the synthesis thread */
+		if (mp3DecInfo->PipelinePS) {
+			PipelineSubmitGranule(mp3DecInfo, gr, pcmBuf);
+			continue;
+		}
 
 		/* alias reduction, inverse MDCT, overlap-add, frequency inversion */
 		for (ch = 0; ch < mp3DecInfo->nChans; ch++)
 		{
-		#ifdef PROFILE
-			time = systime_get();
-		#endif
-			if (IMDCT(mp3DecInfo, gr, ch) < 0) {
+			if (!CHANNEL_USED(mp3DecInfo, ch))
+				continue;
+			t0 = STAGE_START(mp3DecInfo);
+			err = IMDCT(mp3DecInfo, gr, ch);
+			STAGE_END(mp3DecInfo, MP3_STAGE_IMDCT, t0);
+			if (err < 0) {
 				MP3ClearBadFrame(mp3DecInfo, outbuf);
 				return ERR_MP3_INVALID_IMDCT;			
 			}
-		#ifdef PROFILE
-			time = systime_get() - time;
-			printf("IMDCT: %i ms\n", time);
-		#endif
 		}
 		
-		#ifdef PROFILE
-			time = systime_get();
-		#endif
-		/* subband transform - if stereo, interleaves pcm LRLRLR */
-		if (Subband(mp3DecInfo, outbuf + gr*mp3DecInfo->nGranSamps*mp3DecInfo->nChans) < 0) {
+		/* subband transform - if stereo, interleaves pcm LRLRLR (unless planar) */
+		t0 = STAGE_START(mp3DecInfo);
+		err = Subband(mp3DecInfo, pcmBuf);
+		STAGE_END(mp3DecInfo, MP3_STAGE_SUBBAND, t0);
+		if (err < 0) {
 			MP3ClearBadFrame(mp3DecInfo, outbuf);
 			return ERR_MP3_INVALID_SUBBAND;			
 		}
-		#ifdef PROFILE
-			time = systime_get() - time;
-			printf("Subband: %i ms\n", time);
-		#endif
-		
+
+		/* hand this granule out now instead of waiting for the rest of the frame */
+		if (mp3DecInfo->granuleFunc)
+			mp3DecInfo->granuleFunc(mp3DecInfo->granuleUser, pcmBuf, OUT_GRAN_SAMPS(mp3DecInfo)*OUT_CHANS(mp3DecInfo));
 	}
 	return ERR_MP3_NONE;
 }
+
+/**************************************************************************************
+ * Function:    MP3Decode
+ *
+ * Description: decode one frame of MP3 data
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              double pointer to buffer of MP3 data (containing headers + mainData)
+ *              number of valid bytes remaining in inbuf
+ *              pointer to outbuf, big enough to hold one frame of decoded PCM samples
+ *              flag indicating whether MP3 data is normal MPEG format (useSize = 0)
+ *                or reformatted as "self-contained" frames (useSize = 1)
+ *
+ * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo
+ *                number of output samples = nGrans * nGranSamps * nChans
+ *                (divided by the MP3SetDecimation factor)
+ *                (planar output: left at outbuf, right at outbuf + MAX_NGRAN*MAX_NSAMP)
+ *                with 24/32-bit output (MP3SetOutputBits) outbuf is really an int 
+ *                buffer and all offsets count ints
+ *              updated inbuf pointer, updated bytesLeft
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       switching useSize on and off between frames in the same stream 
+ *                is not supported (bit reservoir is not maintained if useSize on)
+ *              in pipelined mode (MP3SetPipelined) the second granule's entropy 
+ *                decoding overlaps the first granule's synthesis, all PCM is 
+ *                in outbuf on return
+ **************************************************************************************/
+int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize)
+{
+	int err;
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (mp3DecInfo)
+		mp3DecInfo->chanStride = (mp3DecInfo->planar ? MAX_NGRAN * MAX_NSAMP : 0);
+	err = DecodeFrame(hMP3Decoder, inbuf, bytesLeft, outbuf, useSize);
+	if (mp3DecInfo && mp3DecInfo->PipelinePS)
+		PipelineFlush(mp3DecInfo);
+
+	return err;
+}
+
+/**************************************************************************************
+ * Function:    MP3DecodeGranules
+ *
+ * Description: decode one frame of MP3 data, delivering each granule as soon as it is 
+ *                synthesized
+ *
+ * Inputs:      same as MP3Decode
+ *              function to call with each granule of PCM (576 samples per channel for
+ *                MPEG 1, two per frame - one granule of 576 for MPEG 2/2.5)
+ *              user pointer passed through to granuleFunc
+ *
+ * Outputs:     PCM data in outbuf, interleaved LRLRLR... if stereo, granule gr starts at
+ *                outbuf + gr * nGranSamps * nChans and is passed to granuleFunc once final
+ *              planar output: as for MP3Decode, granule gr starts at outbuf + gr * nGranSamps
+ *                and its right channel is MAX_NGRAN*MAX_NSAMP samples after the pcm pointer
+ *              updated inbuf pointer, updated bytesLeft
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *
+ * Notes:       lets a sink start writing half a frame earlier than with MP3Decode
+ *              if the second granule is corrupt the first one has already been delivered
+ *                (outbuf is still cleared, as with MP3Decode)
+ *              in pipelined mode (MP3SetPipelined) granuleFunc runs on the synthesis 
+ *                thread, otherwise on the caller's thread; all calls are finished on return
+ **************************************************************************************/
+int MP3DecodeGranules(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize, 
+                      MP3GranuleFunc granuleFunc, void *user)
+{
+	int err;
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo)
+		return ERR_MP3_NULL_POINTER;
+
+	mp3DecInfo->granuleFunc = granuleFunc;
+	mp3DecInfo->granuleUser = user;
+	mp3DecInfo->chanStride = (mp3DecInfo->planar ? MAX_NGRAN * MAX_NSAMP : 0);
+	err = DecodeFrame(hMP3Decoder, inbuf, bytesLeft, outbuf, useSize);
+	if (mp3DecInfo->PipelinePS)
+		PipelineFlush(mp3DecInfo);
+	mp3DecInfo->granuleFunc = 0;
+	mp3DecInfo->granuleUser = 0;
+
+	return err;
+}
+
+/**************************************************************************************
+ * Function:    MP3DecodeFrames
+ *
+ * Description: decode consecutive MP3 frames in one call, until maxFrames have been 
+ *                decoded, outbuf is full, or the input runs out
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              double pointer to buffer of MP3 data (normal MPEG format, see MP3Decode)
+ *              number of valid bytes remaining in inbuf
+ *              pointer to outbuf
+ *              size of outbuf, in samples (shorts, or ints with 24/32-bit output)
+ *              array of maxFrames MP3FrameInfo structs, or 0 if not needed
+ *              max number of frames to decode
+ *
+ * Outputs:     PCM data for nFrames frames, back to back in outbuf
+ *                (planar output: left channel back to back from outbuf, right channel
+ *                from outbuf + outSamps/2 - mono frames only fill the left half)
+ *              info for each decoded frame in frameInfo[0 ... nFrames-1]
+ *              number of frames decoded in nFrames
+ *              updated inbuf pointer, updated bytesLeft
+ *
+ * Return:      ERR_MP3_NONE if stopped because of maxFrames or size of outbuf (nFrames 
+ *                can be 0 if the next frame does not fit in outbuf at all)
+ *              ERR_MP3_INDATA_UNDERFLOW if no complete frame is left in inbuf - inbuf 
+ *                then points to the start of the partial frame (if any), so the caller 
+ *                can append more data and call again
+ *              other error codes only if decoding cannot continue at all
+ *
+ * Notes:       searches for the sync word before every frame
+ *              frames which fail to decode (e.g. ERR_MP3_MAINDATA_UNDERFLOW at the 
+ *                start of a stream) are skipped: they produce no output and no frameInfo
+ **************************************************************************************/
+int MP3DecodeFrames(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int outSamps, 
+                    MP3FrameInfo *frameInfo, int maxFrames, int *nFrames)
+{
+	int offset, err;
+	int frameBytesLeft, frameSamps, maxFrameSamps;
+	unsigned char *frameStart;
+	MP3FrameInfo nextFrameInfo;
+	MP3DecInfo *mp3DecInfo = (MP3DecInfo *)hMP3Decoder;
+
+	if (!mp3DecInfo || !inbuf || !*inbuf || !bytesLeft || !outbuf || !nFrames)
+		return ERR_MP3_NULL_POINTER;
+
+	/* in planar mode outSamps and frameSamps count samples per channel */
+	maxFrameSamps = MAX_NCHAN * MAX_NGRAN * MAX_NSAMP;
+	mp3DecInfo->chanStride = 0;
+	if (mp3DecInfo->planar) {
+		outSamps /= MAX_NCHAN;
+		maxFrameSamps /= MAX_NCHAN;
+		mp3DecInfo->chanStride = outSamps;
+	}
+
+	*nFrames = 0;
+	err = ERR_MP3_NONE;
+	while (*nFrames < maxFrames) {
+		offset = MP3FindSyncWord(*inbuf, *bytesLeft);
+		if (offset < 0) {
+			/* keep the last few bytes, they could be the start of a sync word */
+			offset = MAX(*bytesLeft - 3, 0);
+			*inbuf += offset;
+			*bytesLeft -= offset;
+			err = ERR_MP3_INDATA_UNDERFLOW;
+			break;
+		}
+		*inbuf += offset;
+		*bytesLeft -= offset;
+
+		/* DecodeFrame parses header and side info before it can check the frame length,
+		 *   so stop here if they are not complete (inbuf stays at the start of the partial frame)
+		 */
+		if (*bytesLeft < 4 || *bytesLeft < FrameHeaderSideBytes(*inbuf)) {
+			err = ERR_MP3_INDATA_UNDERFLOW;
+			break;
+		}
+
+		/* only look at the header if the largest possible frame might not fit */
+		if (outSamps < maxFrameSamps) {
+			if (MP3GetNextFrameInfo(hMP3Decoder, &nextFrameInfo, *inbuf) == ERR_MP3_NONE) {
+				frameSamps = nextFrameInfo.outputSamps / (mp3DecInfo->planar ? nextFrameInfo.nChans : 1);
+				if (frameSamps > outSamps)
+					break;
+			}
+		}
+
+		frameStart = *inbuf;
+		frameBytesLeft = *bytesLeft;
+		/* in pipelined mode, synthesis of this frame overlaps decoding of the next one */
+		err = DecodeFrame(hMP3Decoder, inbuf, bytesLeft, outbuf, 0);
+		if (err == ERR_MP3_INDATA_UNDERFLOW) {
+			/* truncated frame - rewind so it can be decoded once the rest of it arrives */
+			*inbuf = frameStart;
+			*bytesLeft = frameBytesLeft;
+			break;
+		} else if (err) {
+			/* skip bad frame, making sure we always move forward */
+			if (*inbuf == frameStart) {
+				(*inbuf)++;
+				(*bytesLeft)--;
+			}
+			err = ERR_MP3_NONE;
+			continue;
+		}
+
+		MP3GetLastFrameInfo(hMP3Decoder, &nextFrameInfo);
+		if (frameInfo)
+			frameInfo[*nFrames] = nextFrameInfo;
+		frameSamps = nextFrameInfo.outputSamps / (mp3DecInfo->planar ? nextFrameInfo.nChans : 1);
+		outbuf += frameSamps * PCM_WORDS(mp3DecInfo);
+		outSamps -= frameSamps;
+		(*nFrames)++;
+	}
+
+	if (mp3DecInfo->PipelinePS)
+		PipelineFlush(mp3DecInfo);
+
+	return err;
+}
@@ -0,0 +1,396 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * mp3par.c - segment-parallel decoding of a complete MP3 file in memory
+ *
+ * The file is indexed once (frame header + side info only), split into contiguous
+ *  runs of frames, and each run is decoded by its own decoder instance on its own 
+ *  thread. Every decoder first decodes some warm-up frames before its run and 
+ *  throws their output away: enough main data to fill the bit reservoir, then 
+ *  frames until two granules in a row have decoded cleanly and at least one frame 
+ *  had no short blocks. The IMDCT overlap only depends on the last granule and the 
+ *  polyphase history on the last granule's output, and long-block scale factors 
+ *  (which a short granule 0 leaves alone, but granule 1 can copy with scfsi) are 
+ *  all rewritten by a frame without short blocks. After that the decoder state 
+ *  matches a decoder which started at the beginning of the file, and the stitched 
+ *  output is sample-identical to calling MP3Decode on every frame in order.
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "mp3common.h"	/* includes mp3dec.h (public API) and internal, platform-independent API */
+
+#if !defined(_WIN32) && !defined(HELIX_NO_THREADS)
+#define HELIX_PTHREADS
+#include <pthread.h>
+#endif
+
+#define WARMUP_FRAMES		2		/* first try at complete frames decoded before each run (doubled until enough decode cleanly) */
+#define WARMUP_GRANS		2		/* granules in a row which must decode cleanly before a run starts */
+#define MIN_SEGMENT_FRAMES	64		/* don't split runs shorter than this (warm-up would dominate) */
+#define MAX_SEGMENTS		64
+
+typedef struct _FrameIndex {
+	int offset;				/* byte offset of frame header in input buffer */
+	int nSlots;				/* bytes of main data in this frame */
+	int outSamps;			/* max samples this frame can produce */
+	int allLongBlocks;		/* no short blocks (resets all the long-block scale factors) */
+} FrameIndex;
+
+typedef struct _SegmentJob {
+	unsigned char *buf;		/* whole input file */
+	int nBytes;
+	FrameIndex *frames;
+	int first;				/* first frame of run */
+	int end;				/* first frame of next run (-1 = decode to end of data) */
+	short *outbuf;
+	int nSamps;				/* output: samples written to outbuf */
+	int err;
+} SegmentJob;
+
+/**************************************************************************************
+ * Function:    IndexFrames
+ *
+ * Description: find every frame MP3Decode would take main data from, stepping 
+ *                through the buffer exactly like MP3DecodeFrames does
+ *
+ * Inputs:      buffer holding the whole MP3 file
+ *              number of bytes in buffer
+ *              pointer to receive malloc'd array of FrameIndex (caller frees)
+ *
+ * Outputs:     frame index, number of frames in nFrames
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ **************************************************************************************/
+static int IndexFrames(unsigned char *buf, int nBytes, FrameIndex **index, int *nFrames)
+{
+	int offset, fhBytes, err, maxFrames;
+	int bytesLeft;
+	unsigned char *inbuf, *frameStart;
+	FrameIndex *frames, *newFrames;
+	MP3DecInfo *mp3DecInfo;
+	MP3FrameInfo mp3FrameInfo;
+
+	mp3DecInfo = (MP3DecInfo *)MP3InitDecoder();
+	if (!mp3DecInfo)
+		return ERR_MP3_OUT_OF_MEMORY;
+
+	maxFrames = 1024;
+	frames = (FrameIndex *)malloc(maxFrames * sizeof(FrameIndex));
+	*nFrames = 0;
+	err = ERR_MP3_NONE;
+
+	inbuf = buf;
+	bytesLeft = nBytes;
+	while (frames && bytesLeft > 0) {
+		offset = MP3FindSyncWord(inbuf, bytesLeft);
+		if (offset < 0)
+			break;
+		inbuf += offset;
+		bytesLeft -= offset;
+
+		frameStart = inbuf;
+		fhBytes = UnpackFrameHeader(mp3DecInfo, inbuf);
+		if (fhBytes < 0) {
+			inbuf++;
+			bytesLeft--;
+			continue;
+		}
+		inbuf += fhBytes;
+		bytesLeft -= fhBytes;
+
+		err = UnpackFrameLayout(mp3DecInfo, &inbuf, &bytesLeft, fhBytes, 0);
+		if (err == ERR_MP3_INDATA_UNDERFLOW)
+			break;
+		else if (err)
+			continue;
+
+		if (*nFrames == maxFrames) {
+			maxFrames *= 2;
+			newFrames = (FrameIndex *)realloc(frames, maxFrames * sizeof(FrameIndex));
+			if (!newFrames)
+				free(frames);
+			frames = newFrames;
+			if (!frames)
+				break;
+		}
+
+		MP3GetLastFrameInfo(mp3DecInfo, &mp3FrameInfo);
+		frames[*nFrames].offset = (int)(frameStart - buf);
+		frames[*nFrames].nSlots = mp3DecInfo->nSlots;
+		frames[*nFrames].outSamps = mp3FrameInfo.outputSamps;
+		frames[*nFrames].allLongBlocks = mp3DecInfo->allLongBlocks;
+		(*nFrames)++;
+
+		inbuf += mp3DecInfo->nSlots;
+		bytesLeft -= mp3DecInfo->nSlots;
+	}
+	MP3FreeDecoder(mp3DecInfo);
+
+	*index = frames;
+	return frames ? ERR_MP3_NONE : ERR_MP3_OUT_OF_MEMORY;
+}
+
+/**************************************************************************************
+ * Function:    DecodeRange
+ *
+ * Description: decode frames the same way MP3DecodeFrames does, until reaching end
+ *
+ * Inputs:      valid MP3 decoder instance pointer (HMP3Decoder)
+ *              double pointer to MP3 data (at a frame MP3DecodeFrames would also visit)
+ *              number of valid bytes remaining in inbuf
+ *              stop before the frame which starts here (0 = decode until out of data)
+ *              pointer to outbuf (large enough), or 0 to throw the output away
+ *
+ * Outputs:     PCM in outbuf
+ *              updated inbuf pointer, updated bytesLeft
+ *              number of granules in a row which decoded cleanly at the end, in goodGrans
+ *
+ * Return:      number of samples written to outbuf
+ **************************************************************************************/
+static int DecodeRange(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, unsigned char *end, 
+                       short *outbuf, int *goodGrans)
+{
+	int offset, err, nSamps;
+	unsigned char *frameStart;
+	MP3FrameInfo mp3FrameInfo;
+	short warmBuf[MAX_NCHAN * MAX_NGRAN * MAX_NSAMP];
+
+	nSamps = 0;
+	*goodGrans = 0;
+	while (*bytesLeft > 0) {
+		offset = MP3FindSyncWord(*inbuf, *bytesLeft);
+		if (offset < 0 || (end && *inbuf + offset >= end))
+			break;
+		*inbuf += offset;
+		*bytesLeft -= offset;
+
+		frameStart = *inbuf;
+		err = MP3Decode(hMP3Decoder, inbuf, bytesLeft, (outbuf ? outbuf + nSamps : warmBuf), 0);
+		if (err == ERR_MP3_INDATA_UNDERFLOW) {
+			break;
+		} else if (err) {
+			/* skip bad frame, making sure we always move forward */
+			if (*inbuf == frameStart) {
+				(*inbuf)++;
+				(*bytesLeft)--;
+			}
+			*goodGrans = 0;
+			continue;
+		}
+
+		MP3GetLastFrameInfo(hMP3Decoder, &mp3FrameInfo);
+		if (outbuf)
+			nSamps += mp3FrameInfo.outputSamps;
+		*goodGrans += (mp3FrameInfo.version == MPEG1 ? NGRANS_MPEG1 : NGRANS_MPEG2);
+	}
+
+	return nSamps;
+}
+
+/**************************************************************************************
+ * Function:    DecodeSegment
+ *
+ * Description: decode one run of frames with a private decoder instance
+ *
+ * Inputs:      pointer to SegmentJob
+ *
+ * Outputs:     PCM for frames [first, end) in job->outbuf, count in job->nSamps
+ *              job->err = 0, or ERR_MP3_OUT_OF_MEMORY if no decoder could be created
+ *
+ * Return:      0 (thread exit value)
+ *
+ * Notes:       if the warm-up frames don't end in WARMUP_GRANS clean granules (e.g. 
+ *                corrupt frames right before the run) or all have short blocks, 
+ *                start twice as far back - at worst from the start of the file
+ **************************************************************************************/
+static void *DecodeSegment(void *arg)
+{
+	int i, j, nWarm, nResv, bytesLeft, goodGrans, sfReset;
+	unsigned char *inbuf, *outStart, *end;
+	SegmentJob *job = (SegmentJob *)arg;
+	FrameIndex *frames = job->frames;
+	HMP3Decoder hMP3Decoder;
+
+	job->nSamps = 0;
+	job->err = ERR_MP3_NONE;
+	hMP3Decoder = MP3InitDecoder();
+	if (!hMP3Decoder) {
+		job->err = ERR_MP3_OUT_OF_MEMORY;
+		return 0;
+	}
+
+	end = (job->end < 0 ? 0 : job->buf + frames[job->end].offset);
+	inbuf = job->buf;
+	bytesLeft = job->nBytes;
+
+	for (nWarm = WARMUP_FRAMES; job->first > 0; nWarm *= 2) {
+		outStart = job->buf + frames[job->first].offset;
+
+		/* back up nWarm frames, then far enough that those frames have their whole bit reservoir */
+		i = job->first - nWarm;
+		for (nResv = 0; i > 0 && nResv < MAINDATA_BEGIN_MAX; nResv += frames[i].nSlots)
+			i--;
+		i = MAX(i, 0);
+
+		/* frames after the reservoir fill decode exactly as in a serial run, one of them must reset the scale factors */
+		sfReset = 0;
+		for (j = MAX(job->first - nWarm, 0); j < job->first; j++)
+			sfReset |= frames[j].allLongBlocks;
+
+		inbuf = job->buf + frames[i].offset;
+		bytesLeft = job->nBytes - frames[i].offset;
+		DecodeRange(hMP3Decoder, &inbuf, &bytesLeft, outStart, 0, &goodGrans);
+		if ((goodGrans >= WARMUP_GRANS && sfReset) || i == 0)
+			break;
+		MP3ResetDecoder(hMP3Decoder);
+	}
+
+	job->nSamps = DecodeRange(hMP3Decoder, &inbuf, &bytesLeft, end, job->outbuf, &goodGrans);
+	MP3FreeDecoder(hMP3Decoder);
+
+	return 0;
+}
+
+/**************************************************************************************
+ * Function:    MP3DecodeParallel
+ *
+ * Description: decode a complete MP3 file on several threads
+ *
+ * Inputs:      buffer holding the whole MP3 file (normal MPEG format, not RFC 3119)
+ *              number of bytes in buffer
+ *              pointer to outbuf, or 0 to just query the size needed
+ *              size of outbuf, in samples (shorts)
+ *              max number of threads to use (<= 1 decodes in the calling thread)
+ *
+ * Outputs:     PCM for the whole file in outbuf, identical to what MP3DecodeFrames
+ *                (or the usual MP3FindSyncWord/MP3Decode loop) produces
+ *              number of samples written in nSamps, or if outbuf is 0 the outbuf size 
+ *                required (upper bound, in samples)
+ *
+ * Return:      error code, defined in mp3dec.h (0 means no error, < 0 means error)
+ *              ERR_MP3_OUT_OF_MEMORY if outSamps is too small or allocation fails
+ *
+ * Notes:       runs are at least MIN_SEGMENT_FRAMES long, so short files use fewer 
+ *                threads than asked for
+ *              builds without pthreads (_WIN32, HELIX_NO_THREADS) decode the runs 
+ *                one after another - output is the same
+ **************************************************************************************/
+int MP3DecodeParallel(unsigned char *buf, int nBytes, short *outbuf, int outSamps, int nThreads, int *nSamps)
+{
+	int i, j, nFrames, nSegs, err, totalSamps;
+	int first[MAX_SEGMENTS + 1], segSamps[MAX_SEGMENTS + 1];
+	FrameIndex *frames;
+	SegmentJob jobs[MAX_SEGMENTS];
+#ifdef HELIX_PTHREADS
+	pthread_t threads[MAX_SEGMENTS];
+	int started[MAX_SEGMENTS];
+#endif
+
+	if (!buf || !nSamps)
+		return ERR_MP3_NULL_POINTER;
+	*nSamps = 0;
+
+	err = IndexFrames(buf, nBytes, &frames, &nFrames);
+	if (err)
+		return err;
+
+	/* outbuf space needed, if every frame decodes */
+	totalSamps = 0;
+	for (i = 0; i < nFrames; i++)
+		totalSamps += frames[i].outSamps;
+	if (!outbuf || outSamps < totalSamps) {
+		free(frames);
+		if (!outbuf) {
+			*nSamps = totalSamps;
+			return ERR_MP3_NONE;
+		}
+		return ERR_MP3_OUT_OF_MEMORY;
+	}
+
+	nSegs = MIN(MAX(nThreads, 1), MAX_SEGMENTS);
+	nSegs = MAX(MIN(nSegs, nFrames / MIN_SEGMENT_FRAMES), 1);
+
+	/* split into runs of (nearly) equal frame count, each writing at its worst-case output offset */
+	segSamps[0] = 0;
+	for (i = 0; i <= nSegs; i++)
+		first[i] = (int)(((long long)nFrames * i) / nSegs);
+	for (i = 0; i < nSegs; i++) {
+		segSamps[i + 1] = segSamps[i];
+		for (j = first[i]; j < first[i + 1]; j++)
+			segSamps[i + 1] += frames[j].outSamps;
+	}
+
+	for (i = 0; i < nSegs; i++) {
+		jobs[i].buf = buf;
+		jobs[i].nBytes = nBytes;
+		jobs[i].frames = frames;
+		jobs[i].first = first[i];
+		jobs[i].end = (i == nSegs - 1 ? -1 : first[i + 1]);
+		jobs[i].outbuf = outbuf + segSamps[i];
+	}
+
+#ifdef HELIX_PTHREADS
+	for (i = 1; i < nSegs; i++)
+		started[i] = (pthread_create(&threads[i], 0, DecodeSegment, &jobs[i]) == 0);
+	DecodeSegment(&jobs[0]);
+	for (i = 1; i < nSegs; i++) {
+		if (started[i])
+			pthread_join(threads[i], 0);
+		else
+			DecodeSegment(&jobs[i]);	/* couldn't start thread - just do it here */
+	}
+#else
+	for (i = 0; i < nSegs; i++)
+		DecodeSegment(&jobs[i]);
+#endif
+
+	/* close the gaps left by frames which failed to decode */
+	err = ERR_MP3_NONE;
+	for (i = 0; i < nSegs; i++) {
+		if (jobs[i].err)
+			err = jobs[i].err;
+		if (jobs[i].outbuf != outbuf + *nSamps)
+			memmove(outbuf + *nSamps, jobs[i].outbuf, jobs[i].nSamps * sizeof(short));
+		*nSamps += jobs[i].nSamps;
+	}
+	free(frames);
+
+	return err;
+}
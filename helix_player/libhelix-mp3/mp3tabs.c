@@ -128,7 +128,7 @@ const short slotTab[3][3][15] = {
  *   sfBandTable[v][s].l[cb] = index of first bin in critical band cb (long blocks)
  *   sfBandTable[v][s].s[cb] = index of first bin in critical band cb (short blocks)
  */
-const SFBandTable sfBandTable[3][3] = {
+CACHE_ALIGNED const SFBandTable sfBandTable[3][3] = {
 	{
 		/* MPEG-1 (44, 48, 32 kHz) */
 		{
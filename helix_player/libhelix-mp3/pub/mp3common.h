@@ -47,6 +47,14 @@
 #include "mp3dec.h"
 #include "statname.h"	/* do name-mangling for static linking */
 
+#ifndef MAX
+#define MAX(a,b)	((a) > (b) ? (a) : (b))
+#endif
+
+#ifndef MIN
+#define MIN(a,b)	((a) < (b) ? (a) : (b))
+#endif
+
 #define MAX_SCFBD		4		/* max scalefactor bands per channel */
 #define NGRANS_MPEG1	2
 #define NGRANS_MPEG2	1
@@ -61,6 +69,21 @@
 #define	SYNCWORDH		0xff
 #define	SYNCWORDL		0xf0
 
+/* main data window: new main_data is appended at mainDataStart + mainDataBytes, and only when 
+ *   the end is reached is the bit reservoir (at most MAINDATA_BEGIN_MAX bytes) moved back to the start
+ */
+#define MAINDATA_BEGIN_MAX	511		/* 9-bit main_data_begin (MPEG 1), MPEG 2 uses 8 bits */
+#define MAINBUF_WINDOW		(4 * MAINBUF_SIZE)
+
+/* start a constant table on a cache line boundary, so small tables don't straddle two lines */
+#if defined(__GNUC__)
+#define CACHE_ALIGNED	__attribute__((aligned(64)))
+#elif defined(_MSC_VER)
+#define CACHE_ALIGNED	__declspec(align(64))
+#else
+#define CACHE_ALIGNED
+#endif
+
 typedef struct _MP3DecInfo {
 	/* pointers to platform-specific data structures */
 	void *FrameHeaderPS;
@@ -70,9 +93,7 @@ typedef struct _MP3DecInfo {
 	void *DequantInfoPS;
 	void *IMDCTInfoPS;
 	void *SubbandInfoPS;
-
-	/* buffer which must be large enough to hold largest possible main_data section */
-	unsigned char mainBuf[MAINBUF_SIZE];
+	void *PipelinePS;		/* synthesis thread and granule queue, 0 unless pipelined (MP3SetPipelined) */
 
 	/* special info for "free" bitrate files */
 	int freeBitrateFlag;
@@ -90,11 +111,54 @@ typedef struct _MP3DecInfo {
 
 	int mainDataBegin;
 	int mainDataBytes;
+	int mainDataStart;		/* offset of oldest valid byte in mainBuf */
+	int allLongBlocks;		/* side info of last frame has no short blocks */
 
 	int part23Length[MAX_NGRAN][MAX_NCHAN];
 
+	/* PCM layout: planar set by MP3SetPlanarOutput, chanStride = offset of channel 1 for the current call (0 = interleaved) */
+	int planar;
+	int chanStride;
+	int bitsPerSample;		/* 16 (short samples), or 24/32 (int samples) - see MP3SetOutputBits */
+	MP3ChannelMode channelMode;
+	int decimate;			/* 1, 2 or 4: synthesize only the lowest NBANDS/decimate subbands (MP3SetDecimation) */
+
+	/* per-granule output callback, only set during MP3DecodeGranules */
+	MP3GranuleFunc granuleFunc;
+	void *granuleUser;
+
+	/* per-stage timing: points to stats while enabled (MP3SetStageStats), 0 otherwise */
+	MP3StageStats *stageStats;
+
+	/* SIMD extensions available on this CPU (set once, in MP3InitDecoder) */
+	int simdCaps;
+
+	/* everything above is used on every frame and fits in a few cache lines, 
+	 *   large or rarely used members go below so they don't split it up
+	 */
+
+	/* block from malloc() which holds this struct and all the *PS structs, 0 if caller-provided */
+	void *allocBuf;
+	MP3StageStats stats;
+
+	/* sliding window over the main_data stream, must hold bit reservoir + largest possible main_data section */
+	unsigned char mainBuf[MAINBUF_WINDOW];
+
 } MP3DecInfo;
 
+/* channels in the PCM output, and whether coded channel ch is decoded at all (channelMode) */
+#define OUT_CHANS(mp3DecInfo)	((mp3DecInfo)->channelMode == MP3_CHANNELS_ALL ? (mp3DecInfo)->nChans : 1)
+#define CHANNEL_USED(mp3DecInfo, ch)	((mp3DecInfo)->nChans == 1 || (mp3DecInfo)->channelMode == MP3_CHANNELS_ALL || \
+	(mp3DecInfo)->channelMode == MP3_CHANNELS_MIX || (int)(mp3DecInfo)->channelMode == MP3_CHANNELS_LEFT + (ch))
+
+/* PCM samples per channel per granule after reduced-rate synthesis */
+#define OUT_GRAN_SAMPS(mp3DecInfo)	((mp3DecInfo)->nGranSamps / (mp3DecInfo)->decimate)
+
+/* time one decoder stage - when stats are off this is just a test of stageStats */
+#define STAGE_START(mp3DecInfo)	((mp3DecInfo)->stageStats ? GetStageClock() : 0)
+#define STAGE_END(mp3DecInfo, stage, t0)	if ((mp3DecInfo)->stageStats) { \
+	(mp3DecInfo)->stageStats->nsec[stage] += GetStageClock() - (t0);	(mp3DecInfo)->stageStats->calls[stage]++; }
+
 typedef struct _SFBandTable {
 	short l[23];
 	short s[14];
@@ -103,14 +167,28 @@ typedef struct _SFBandTable {
 /* decoder functions which must be implemented for each platform */
 MP3DecInfo *AllocateBuffers(void);
 void FreeBuffers(MP3DecInfo *mp3DecInfo);
+int GetBufferSize(void);
+MP3DecInfo *InitBuffers(void *buf, int nBytes);
+void ResetBuffers(MP3DecInfo *mp3DecInfo);
 int CheckPadBit(MP3DecInfo *mp3DecInfo);
 int UnpackFrameHeader(MP3DecInfo *mp3DecInfo, unsigned char *buf);
 int UnpackSideInfo(MP3DecInfo *mp3DecInfo, unsigned char *buf);
+int UnpackFrameLayout(MP3DecInfo *mp3DecInfo, unsigned char **inbuf, int *bytesLeft, int fhBytes, int useSize);
 int DecodeHuffman(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, int huffBlockBits, int gr, int ch);
 int Dequantize(MP3DecInfo *mp3DecInfo, int gr);
 int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch);
 int UnpackScaleFactors(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, int bitsAvail, int gr, int ch);
 int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf);
+int GetSIMDCaps(void);
+int PipelineCreate(MP3DecInfo *mp3DecInfo);
+void PipelineDestroy(MP3DecInfo *mp3DecInfo);
+void PipelineBeginGranule(MP3DecInfo *mp3DecInfo);
+void PipelineSubmitGranule(MP3DecInfo *mp3DecInfo, int gr, short *pcmBuf);
+void PipelineFlush(MP3DecInfo *mp3DecInfo);
+MP3Counter GetStageClock(void);
+int GetStateSize(void);
+int SaveState(MP3DecInfo *mp3DecInfo, unsigned char *buf, int nBytes);
+int RestoreState(MP3DecInfo *mp3DecInfo, const unsigned char *buf, int nBytes);
 
 /* mp3tabs.c - global ROM tables */
 extern const int samplerateTab[3][3];
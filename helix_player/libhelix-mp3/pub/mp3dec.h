@@ -86,6 +86,14 @@ typedef enum {
 	MPEG25 = 2
 } MPEGVersion;
 
+/* which channels reach the PCM output (see MP3SetChannelMode) */
+typedef enum {
+	MP3_CHANNELS_ALL =   0,		/* as coded (default) */
+	MP3_CHANNELS_LEFT =  1,		/* left (or first) channel only, mono output */
+	MP3_CHANNELS_RIGHT = 2,		/* right (or second) channel only, mono output */
+	MP3_CHANNELS_MIX =   3		/* (left + right) / 2, mono output */
+} MP3ChannelMode;
+
 typedef void *HMP3Decoder;
 
 enum {
@@ -102,6 +110,7 @@ enum {
 	ERR_MP3_INVALID_DEQUANTIZE =   -10,
 	ERR_MP3_INVALID_IMDCT =        -11,
 	ERR_MP3_INVALID_SUBBAND =      -12,
+	ERR_MP3_INVALID_PARAM =        -13,
 
 	ERR_UNKNOWN =                  -9999
 };
@@ -116,10 +125,62 @@ typedef struct _MP3FrameInfo {
 	int version;
 } MP3FrameInfo;
 
+/* 64-bit unsigned counter */
+#if defined(_WIN32) && !defined(__GNUC__)
+typedef unsigned __int64 MP3Counter;
+#else
+typedef unsigned long long MP3Counter;
+#endif
+
+/* decoder stages timed by MP3SetStageStats */
+typedef enum {
+	MP3_STAGE_SIDEINFO = 0,		/* frame header + side info */
+	MP3_STAGE_MAINDATA,			/* bit reservoir bookkeeping */
+	MP3_STAGE_SCALEFACT,
+	MP3_STAGE_HUFFMAN,
+	MP3_STAGE_DEQUANT,			/* includes stereo processing */
+	MP3_STAGE_IMDCT,
+	MP3_STAGE_SUBBAND,			/* DCT + polyphase filter */
+
+	MP3_NUM_STAGES
+} MP3Stage;
+
+typedef struct _MP3StageStats {
+	MP3Counter nsec[MP3_NUM_STAGES];	/* total time spent in each stage, in ns */
+	MP3Counter calls[MP3_NUM_STAGES];	/* per frame, granule, or channel - as the stage runs */
+} MP3StageStats;
+
+/* called by MP3DecodeGranules as soon as each granule of PCM is ready (nSamps = nGranSamps * nChans, divided by the MP3SetDecimation factor) 
+ *   planar output: pcm is the left channel, right channel starts MAX_NGRAN*MAX_NSAMP samples later
+ *   24/32-bit output (MP3SetOutputBits): pcm really points to ints
+ */
+typedef void (*MP3GranuleFunc)(void *user, short *pcm, int nSamps);
+
 /* public API */
 HMP3Decoder MP3InitDecoder(void);
 void MP3FreeDecoder(HMP3Decoder hMP3Decoder);
+int MP3GetDecoderSize(void);
+HMP3Decoder MP3InitDecoderInPlace(void *mem, int nBytes);
+void MP3ResetDecoder(HMP3Decoder hMP3Decoder);
+int MP3SetPipelined(HMP3Decoder hMP3Decoder, int enable);
+int MP3SetPlanarOutput(HMP3Decoder hMP3Decoder, int planar);
+int MP3SetOutputBits(HMP3Decoder hMP3Decoder, int bitsPerSample);
+int MP3SetChannelMode(HMP3Decoder hMP3Decoder, MP3ChannelMode channelMode);
+int MP3SetDecimation(HMP3Decoder hMP3Decoder, int factor);
+int MP3SetStageStats(HMP3Decoder hMP3Decoder, int enable);
+int MP3GetStageStats(HMP3Decoder hMP3Decoder, MP3StageStats *stageStats);
+int MP3GetStateSize(void);
+int MP3SaveState(HMP3Decoder hMP3Decoder, unsigned char *buf, int bufSize, int *stateBytes);
+int MP3RestoreState(HMP3Decoder hMP3Decoder, const unsigned char *buf, int stateBytes);
 int MP3Decode(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize);
+int MP3DecodeGranules(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int useSize, 
+                      MP3GranuleFunc granuleFunc, void *user);
+int MP3DecodeFrames(HMP3Decoder hMP3Decoder, unsigned char **inbuf, int *bytesLeft, short *outbuf, int outSamps, 
+                    MP3FrameInfo *frameInfo, int maxFrames, int *nFrames);
+int MP3DecodeParallel(unsigned char *buf, int nBytes, short *outbuf, int outSamps, int nThreads, int *nSamps);
+int MP3ToADU(unsigned char *buf, int nBytes, unsigned char *aduBuf, int aduBufSize, int *aduBytes);
+int MP3FromADU(unsigned char *aduBuf, int nBytes, unsigned char *buf, int bufSize, int *nOutBytes);
+int MP3ReadADUDescriptor(unsigned char *buf, int nBytes, int *aduSize);
 
 void MP3GetLastFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo);
 int MP3GetNextFrameInfo(HMP3Decoder hMP3Decoder, MP3FrameInfo *mp3FrameInfo, unsigned char *buf);
@@ -63,13 +63,27 @@
 #define	CheckPadBit			STATNAME(CheckPadBit)
 #define	UnpackFrameHeader	STATNAME(UnpackFrameHeader)
 #define	UnpackSideInfo		STATNAME(UnpackSideInfo)
+#define	UnpackFrameLayout	STATNAME(UnpackFrameLayout)
 #define	AllocateBuffers		STATNAME(AllocateBuffers)
 #define	FreeBuffers			STATNAME(FreeBuffers)
+#define	GetBufferSize		STATNAME(GetBufferSize)
+#define	InitBuffers			STATNAME(InitBuffers)
+#define	ResetBuffers		STATNAME(ResetBuffers)
 #define	DecodeHuffman		STATNAME(DecodeHuffman)
 #define	Dequantize			STATNAME(Dequantize)
 #define	IMDCT				STATNAME(IMDCT)
 #define	UnpackScaleFactors	STATNAME(UnpackScaleFactors)
 #define	Subband				STATNAME(Subband)
+#define	GetSIMDCaps			STATNAME(GetSIMDCaps)
+#define	PipelineCreate		STATNAME(PipelineCreate)
+#define	PipelineDestroy		STATNAME(PipelineDestroy)
+#define	PipelineBeginGranule	STATNAME(PipelineBeginGranule)
+#define	PipelineSubmitGranule	STATNAME(PipelineSubmitGranule)
+#define	PipelineFlush		STATNAME(PipelineFlush)
+#define	GetStageClock		STATNAME(GetStageClock)
+#define	GetStateSize		STATNAME(GetStateSize)
+#define	SaveState			STATNAME(SaveState)
+#define	RestoreState		STATNAME(RestoreState)
 
 #define	samplerateTab		STATNAME(samplerateTab)
 #define	bitrateTab			STATNAME(bitrateTab)
@@ -41,7 +41,8 @@
  * assembly.h - assembly language functions and prototypes for supported platforms
  *
  * - inline rountines with access to 64-bit multiply results 
- * - x86 (_WIN32) and ARM (ARM_ADS, _WIN32_WCE) versions included
+ * - x86 (_WIN32), x86-64 (gcc/clang), ARM (ARM_ADS, _WIN32_WCE) and RISC-V versions included
+ * - define NO_ASSEMBLY to use the portable C versions on any platform
  * - some inline functions are mix of asm and C for speed
  * - some functions are in native asm files, so only the prototype is given here
  *
@@ -56,7 +57,12 @@
 #ifndef _ASSEMBLY_H
 #define _ASSEMBLY_H
 
-#if (defined _WIN32 && !defined _WIN32_WCE) || (defined __WINS__ && defined _SYMBIAN) || defined(_OPENWAVE_SIMULATOR) || defined(WINCE_EMULATOR)    /* Symbian emulator for Ix86 */
+#if defined(NO_ASSEMBLY)
+
+/* C reference versions on every platform (e.g. to compare against a native backend) */
+#define ASSEMBLY_GENERIC
+
+#elif (defined _WIN32 && !defined _WIN32_WCE) || (defined __WINS__ && defined _SYMBIAN) || defined(_OPENWAVE_SIMULATOR) || defined(WINCE_EMULATOR)    /* Symbian emulator for Ix86 */
 
 #pragma warning( disable : 4035 )	/* complains about inline asm not returning a value */
 
@@ -297,9 +303,15 @@ static __inline Word64 MADD64(Word64 sum64, int x, int y)
 
 	return sum64;
 }
+
+static __inline Word64 SHL64(Word64 x, int n) {
+	return x << n;
+}
 	
 #else
 
+typedef long long Word64;
+
 static __inline int MULSHIFT32(int x, int y)
 {
 	/* important rules for smull RdLo, RdHi, Rm, Rs:
@@ -318,6 +330,22 @@ static __inline int MULSHIFT32(int x, int y)
 	return y;
 }
 
+/* plain C - gcc emits a single smlal for this, and can schedule it (no asm volatile) */
+static __inline Word64 MADD64(Word64 sum64, int x, int y)
+{
+	return sum64 + (Word64)x * y;
+}
+
+static __inline Word64 SHL64(Word64 x, int n)
+{
+	return x << n;
+}
+
+static __inline Word64 SAR64(Word64 x, int n)
+{
+	return x >> n;
+}
+
 #endif
 
 static __inline int FASTABS(int x) 
@@ -351,59 +379,40 @@ static __inline int CLZ(int x)
 }
 
 #elif defined(__GNUC__) && defined(__x86_64__)
+
+/* gcc and clang, x86-64: written in C so the compiler can schedule around them (no asm volatile), 
+ *   MULSHIFT32 and MADD64 compile to a single 64-bit imul (and add), CLZ to lzcnt or bsr
+ */
 typedef long long Word64;
 
-#if defined(__OPTIMIZE__) && __OPTIMIZE__ >= 2
-static __inline int MULSHIFT32(int x, int y) {
-    return (int)(((Word64)x * y) >> 32);
-}
-#else
 static __inline int MULSHIFT32(int x, int y)
 {
-    int result;
-    __asm__ volatile (
-        "imull   %2"
-        : "=d" (result)
-        : "a" (x), "r" (y)
-        : "cc"
-    );
-    return result;
+	return (int)(((Word64)x * y) >> 32);
 }
-#endif
 
 static __inline int FASTABS(int x)
 {
-#if __has_builtin(__builtin_abs)
-    return __builtin_abs(x);
-#else
-    int mask = x >> 31;
-    return (x ^ mask) - mask;
-#endif
+	int sign;
+
+	/* not __builtin_abs, which is undefined for 0x80000000 - must match the other platforms */
+	sign = x >> (sizeof(int) * 8 - 1);
+	x ^= sign;
+	x -= sign;
+
+	return x;
 }
 
 static __inline int CLZ(int x)
 {
-    if (__builtin_expect(!x, 0)) 
-		return 32;
-    
-#if __has_builtin(__builtin_clz)
-    return __builtin_clz(x);
-#else
-    int result;
-    __asm__ volatile (
-        "bsrl    %1, %0\n\t"
-        "xorl    $31, %0"
-        : "=r" (result)
-        : "r" (x)
-        : "cc"
-    );
-    return result;
-#endif
+	if (!x)
+		return (sizeof(int) * 8);
+
+	return __builtin_clz((unsigned int)x);
 }
 
-static __inline Word64 MADD64(Word64 sum, int a, int b)
+static __inline Word64 MADD64(Word64 sum, int x, int y)
 {
-	return sum + (Word64)a * (Word64)b;
+	return sum + (Word64)x * y;
 }
 
 static __inline Word64 SHL64(Word64 x, int n)
@@ -415,9 +424,8 @@ static __inline Word64 SAR64(Word64 x, int n)
 {
 	return x >> n;
 }
-#else
 
-#ifdef __riscv
+#elif defined(__riscv)
 
 typedef long long Word64;
 
@@ -481,6 +489,13 @@ static __inline Word64 SAR64(Word64 x, int n)
 
 #else
 
+#define ASSEMBLY_GENERIC
+
+#endif	/* platforms */
+
+/* portable C versions, for platforms without any of the above and for NO_ASSEMBLY builds */
+#ifdef ASSEMBLY_GENERIC
+
 typedef long long Word64;
 
 static __inline int MULSHIFT32(int x, int y)
@@ -532,8 +547,6 @@ static __inline Word64 SAR64(Word64 x, int n)
 	return x >> n;
 }
 
-#endif
-
-#endif	/* platforms */
+#endif	/* ASSEMBLY_GENERIC */
 
 #endif /* _ASSEMBLY_H */
\ No newline at end of file
@@ -41,6 +41,7 @@
  * bitstream.c - bitstream unpacking, frame header parsing, side info parsing
  **************************************************************************************/
 
+#include <string.h>
 #include "coder.h"
 #include "assembly.h"
 
@@ -61,11 +62,44 @@ void SetBitstreamPointer(BitStreamInfo *bsi, int nBytes, unsigned char *buf)
 {
 	/* init bitstream */
 	bsi->bytePtr = buf;
-	bsi->iCache = 0;		/* 4-byte unsigned int */
+	bsi->iCache = 0;		/* 8-byte unsigned int */
 	bsi->cachedBits = 0;	/* i.e. zero bits in cache */
 	bsi->nBytes = nBytes;
 }
 
+/**************************************************************************************
+ * Function:    LoadBigEndian64
+ *
+ * Description: read 8 bytes from any (unaligned) address as a big-endian 64-bit value
+ *
+ * Inputs:      pointer to 8 bytes of data
+ *
+ * Outputs:     none
+ *
+ * Return:      the 8 bytes, first byte in the MSB's
+ *
+ * Notes:       memcpy of a constant 8 bytes compiles to a single load (plus a byte 
+ *                swap on little-endian machines) with gcc and clang
+ **************************************************************************************/
+static __inline BitCache64 LoadBigEndian64(const unsigned char *buf)
+{
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	BitCache64 x;
+
+	memcpy(&x, buf, 8);
+	return __builtin_bswap64(x);
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	BitCache64 x;
+
+	memcpy(&x, buf, 8);
+	return x;
+#else
+	/* independent of machine endian-ness */
+	return ((BitCache64)buf[0] << 56) | ((BitCache64)buf[1] << 48) | ((BitCache64)buf[2] << 40) | ((BitCache64)buf[3] << 32) | 
+		   ((BitCache64)buf[4] << 24) | ((BitCache64)buf[5] << 16) | ((BitCache64)buf[6] <<  8) | ((BitCache64)buf[7]);
+#endif
+}
+
 /**************************************************************************************
  * Function:    RefillBitstreamCache
  *
@@ -77,34 +111,31 @@ void SetBitstreamPointer(BitStreamInfo *bsi, int nBytes, unsigned char *buf)
  *
  * Return:      none
  *
- * Notes:       only call when iCache is completely drained (resets bitOffset to 0)
- *              always loads 4 new bytes except when bsi->nBytes < 4 (end of buffer)
+ * Notes:       tops up iCache with whole bytes, to at least 57 bits (or until the end of
+ *                the buffer), so only call when cachedBits < 32
+ *              if at least 8 bytes remain, uses one unaligned 8-byte load - the bits 
+ *                below the last whole byte are the next bytes in the stream, so they 
+ *                are already correct when the next refill ORs them in again
+ *              never reads beyond bytePtr + nBytes
  *              stores data as big-endian in cache, regardless of machine endian-ness
- *
- * TODO:        optimize for ARM
- *              possibly add little/big-endian modes for doing 32-bit loads
  **************************************************************************************/
 static __inline void RefillBitstreamCache(BitStreamInfo *bsi)
 {
-	int nBytes = bsi->nBytes;
-
-	/* optimize for common case, independent of machine endian-ness */
-	if (nBytes >= 4) {
-		bsi->iCache  = (*bsi->bytePtr++) << 24;
-		bsi->iCache |= (*bsi->bytePtr++) << 16;
-		bsi->iCache |= (*bsi->bytePtr++) <<  8;
-		bsi->iCache |= (*bsi->bytePtr++);
-		bsi->cachedBits = 32;
-		bsi->nBytes -= 4;
+	int nBytes;
+
+	if (bsi->nBytes >= 8) {
+		bsi->iCache |= LoadBigEndian64(bsi->bytePtr) >> bsi->cachedBits;
+		nBytes = (63 - bsi->cachedBits) >> 3;
+		bsi->bytePtr += nBytes;
+		bsi->nBytes -= nBytes;
+		bsi->cachedBits += 8*nBytes;
 	} else {
-		bsi->iCache = 0;
-		while (nBytes--) {
-			bsi->iCache |= (*bsi->bytePtr++);
-			bsi->iCache <<= 8;
+		/* end of buffer */
+		while (bsi->nBytes > 0 && bsi->cachedBits <= 56) {
+			bsi->iCache |= (BitCache64)(*bsi->bytePtr++) << (56 - bsi->cachedBits);
+			bsi->cachedBits += 8;
+			bsi->nBytes--;
 		}
-		bsi->iCache <<= ((3 - bsi->nBytes)*8);
-		bsi->cachedBits = 8*bsi->nBytes;
-		bsi->nBytes = 0;
 	}
 }
 
@@ -122,30 +153,23 @@ static __inline void RefillBitstreamCache(BitStreamInfo *bsi)
  *
  * Notes:       nBits must be in range [0, 31], nBits outside this range masked by 0x1f
  *              for speed, does not indicate error if you overrun bit buffer 
+ *                (returns 0's, and cachedBits goes negative so CalcBitsUsed() still 
+ *                counts the bits)
  *              if nBits = 0, returns 0 (useful for scalefactor unpacking)
- *
- * TODO:        optimize for ARM
+ *              with a 64-bit cache, refills are only needed every 4 to 7 bytes
  **************************************************************************************/
 unsigned int GetBits(BitStreamInfo *bsi, int nBits)
 {
-	unsigned int data, lowBits;
+	unsigned int data;
 
 	nBits &= 0x1f;							/* nBits mod 32 to avoid unpredictable results like >> by negative amount */
-	data = bsi->iCache >> (31 - nBits);		/* unsigned >> so zero-extend */
-	data >>= 1;								/* do as >> 31, >> 1 so that nBits = 0 works okay (returns 0) */
+	if (bsi->cachedBits < nBits)
+		RefillBitstreamCache(bsi);
+
+	data = (unsigned int)((bsi->iCache >> 1) >> (63 - nBits));	/* do as >> 1, >> 63 so that nBits = 0 works okay (returns 0) */
 	bsi->iCache <<= nBits;					/* left-justify cache */
 	bsi->cachedBits -= nBits;				/* how many bits have we drawn from the cache so far */
 
-	/* if we cross an int boundary, refill the cache */
-	if (bsi->cachedBits < 0) {
-		lowBits = -bsi->cachedBits;
-		RefillBitstreamCache(bsi);
-		data |= bsi->iCache >> (32 - lowBits);		/* get the low-order bits */
-	
-		bsi->cachedBits -= lowBits;			/* how many bits have we drawn from the cache so far */
-		bsi->iCache <<= lowBits;			/* left-justify cache */
-	}
-
 	return data;
 }
 
@@ -290,7 +314,7 @@ int UnpackFrameHeader(MP3DecInfo *mp3DecInfo, unsigned char *buf)
  * Inputs:      MP3DecInfo structure filled by UnpackFrameHeader()
  *              buffer pointing to the MP3 side info data
  *
- * Outputs:     updated mainDataBegin in MP3DecInfo struct
+ * Outputs:     updated mainDataBegin, allLongBlocks and part23Length in MP3DecInfo struct
  *              updated private (platform-specific) SideInfo struct
  *
  * Return:      length (in bytes) of side info data
@@ -382,6 +406,17 @@ int UnpackSideInfo(MP3DecInfo *mp3DecInfo, unsigned char *buf)
 	}
 	mp3DecInfo->mainDataBegin = si->mainDataBegin;	/* needed by main decode loop */
 
+	/* no short blocks means every long-block scale factor gets rewritten (see MP3DecodeParallel) 
+	 *   part23Length gives the size of the frame's main data before any of it is read (see MP3ToADU)
+	 */
+	mp3DecInfo->allLongBlocks = 1;
+	for (gr = 0; gr < mp3DecInfo->nGrans; gr++) {
+		for (ch = 0; ch < mp3DecInfo->nChans; ch++) {
+			mp3DecInfo->allLongBlocks &= (si->sis[gr][ch].blockType != 2);
+			mp3DecInfo->part23Length[gr][ch] = si->sis[gr][ch].part23Length;
+		}
+	}
+
 	ASSERT(nBytes == CalcBitsUsed(bsi, buf, 0) >> 3);
 
 	return nBytes;	
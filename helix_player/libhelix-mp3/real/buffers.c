@@ -43,6 +43,8 @@
  * All memory allocation for the codec is done in this file, so if you don't want 
  *  to use other the default system malloc() and free() for heap management this is 
  *  the only file you'll need to change.
+ * All the decoder state lives in one cache-line-aligned block, which can also be
+ *  provided by the caller (see InitBuffers).
  **************************************************************************************/
 
 //#include "hlxclib/stdlib.h"		/* for malloc, free */ 
@@ -50,29 +52,138 @@
 #include <string.h>
 #include "coder.h"
 
+#define CACHE_LINE_SIZE		64
+#define ALIGN_CACHE(n)		(((n) + CACHE_LINE_SIZE - 1) & ~(CACHE_LINE_SIZE - 1))
+
+/* every struct starts on its own cache line, MP3DecInfo first (in hot-path order after that) */
+#define OFFSET_FH			ALIGN_CACHE(sizeof(MP3DecInfo))
+#define OFFSET_SI			(OFFSET_FH  + ALIGN_CACHE(sizeof(FrameHeader)))
+#define OFFSET_SFI			(OFFSET_SI  + ALIGN_CACHE(sizeof(SideInfo)))
+#define OFFSET_HI			(OFFSET_SFI + ALIGN_CACHE(sizeof(ScaleFactorInfo)))
+#define OFFSET_DI			(OFFSET_HI  + ALIGN_CACHE(sizeof(HuffmanInfo)))
+#define OFFSET_MI			(OFFSET_DI  + ALIGN_CACHE(sizeof(DequantInfo)))
+#define OFFSET_SBI			(OFFSET_MI  + ALIGN_CACHE(sizeof(IMDCTInfo)))
+#define DECODER_BYTES		(OFFSET_SBI + ALIGN_CACHE(sizeof(SubbandInfo)))
+
 /**************************************************************************************
- * Function:    ClearBuffer
+ * Function:    SetupBuffers
  *
- * Description: fill buffer with 0's
+ * Description: lay out and clear all the decoder state in one contiguous block
  *
- * Inputs:      pointer to buffer
- *              number of bytes to fill with 0
+ * Inputs:      pointer to DECODER_BYTES bytes of memory, aligned to CACHE_LINE_SIZE
  *
- * Outputs:     cleared buffer
+ * Outputs:     cleared memory, with MP3DecInfo at the start
  *
- * Return:      none
+ * Return:      pointer to MP3DecInfo structure (initialized with pointers to all 
+ *                the internal buffers needed for decoding, all other members of 
+ *                MP3DecInfo structure set to 0)
+ **************************************************************************************/
+static MP3DecInfo *SetupBuffers(unsigned char *base)
+{
+	MP3DecInfo *mp3DecInfo;
+
+	/* important to do this - DSP primitives assume a bunch of state variables are 0 on first use */
+	memset(base, 0, DECODER_BYTES);
+
+	mp3DecInfo = (MP3DecInfo *)base;
+	mp3DecInfo->FrameHeaderPS =     (void *)(base + OFFSET_FH);
+	mp3DecInfo->SideInfoPS =        (void *)(base + OFFSET_SI);
+	mp3DecInfo->ScaleFactorInfoPS = (void *)(base + OFFSET_SFI);
+	mp3DecInfo->HuffmanInfoPS =     (void *)(base + OFFSET_HI);
+	mp3DecInfo->DequantInfoPS =     (void *)(base + OFFSET_DI);
+	mp3DecInfo->IMDCTInfoPS =       (void *)(base + OFFSET_MI);
+	mp3DecInfo->SubbandInfoPS =     (void *)(base + OFFSET_SBI);
+	mp3DecInfo->bitsPerSample = 16;
+	mp3DecInfo->decimate = 1;
+
+	return mp3DecInfo;
+}
+
+/**************************************************************************************
+ * Function:    GetBufferSize
+ *
+ * Description: number of bytes needed by InitBuffers
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      size of all decoder state, plus slack for aligning an arbitrary pointer
+ **************************************************************************************/
+int GetBufferSize(void)
+{
+	return DECODER_BYTES + CACHE_LINE_SIZE - 1;
+}
+
+/**************************************************************************************
+ * Function:    InitBuffers
  *
- * Notes:       slow, platform-independent equivalent to memset(buf, 0, nBytes)
+ * Description: place all the decoder state in caller-provided memory
+ *
+ * Inputs:      pointer to memory (any alignment)
+ *              number of bytes available in buf
+ *
+ * Outputs:     none
+ *
+ * Return:      pointer to MP3DecInfo structure (see SetupBuffers), somewhere in the 
+ *                first CACHE_LINE_SIZE bytes of buf
+ *              0 if buf is null or smaller than GetBufferSize()
+ *
+ * Notes:       caller owns buf, FreeBuffers does not release it
+ **************************************************************************************/
+MP3DecInfo *InitBuffers(void *buf, int nBytes)
+{
+	unsigned char *base;
+
+	if (!buf || nBytes < GetBufferSize())
+		return 0;
+
+	base = (unsigned char *)buf + ((CACHE_LINE_SIZE - ((size_t)buf & (CACHE_LINE_SIZE - 1))) & (CACHE_LINE_SIZE - 1));
+
+	return SetupBuffers(base);
+}
+
+/**************************************************************************************
+ * Function:    ResetBuffers
+ *
+ * Description: return decoder to the just-initialized state without reallocating
+ *
+ * Inputs:      pointer to MP3DecInfo structure from AllocateBuffers or InitBuffers
+ *
+ * Outputs:     all decoder state cleared (ownership, SIMD caps, pipeline, output 
+ *                format and channel mode are kept)
+ *
+ * Return:      none
  **************************************************************************************/
-static void ClearBuffer(void *buf, int nBytes)
+void ResetBuffers(MP3DecInfo *mp3DecInfo)
 {
-	int i;
-	unsigned char *cbuf = (unsigned char *)buf;
+	void *allocBuf, *pipeline;
+	int simdCaps, planar, bitsPerSample, decimate, statsOn;
+	MP3ChannelMode channelMode;
+	MP3StageStats stats;
 
-	for (i = 0; i < nBytes; i++)
-		cbuf[i] = 0;
+	if (!mp3DecInfo)
+		return;
 
-	return;
+	allocBuf = mp3DecInfo->allocBuf;
+	pipeline = mp3DecInfo->PipelinePS;
+	simdCaps = mp3DecInfo->simdCaps;
+	planar = mp3DecInfo->planar;
+	bitsPerSample = mp3DecInfo->bitsPerSample;
+	channelMode = mp3DecInfo->channelMode;
+	decimate = mp3DecInfo->decimate;
+	statsOn = (mp3DecInfo->stageStats != 0);
+	stats = mp3DecInfo->stats;
+	mp3DecInfo = SetupBuffers((unsigned char *)mp3DecInfo);
+	mp3DecInfo->allocBuf = allocBuf;
+	mp3DecInfo->PipelinePS = pipeline;
+	mp3DecInfo->simdCaps = simdCaps;
+	mp3DecInfo->planar = planar;
+	mp3DecInfo->bitsPerSample = bitsPerSample;
+	mp3DecInfo->channelMode = channelMode;
+	mp3DecInfo->decimate = decimate;
+	mp3DecInfo->stageStats = (statsOn ? &mp3DecInfo->stats : 0);
+	mp3DecInfo->stats = stats;
 }
 
 /**************************************************************************************
@@ -88,60 +199,23 @@ static void ClearBuffer(void *buf, int nBytes)
  *                the internal buffers needed for decoding, all other members of 
  *                MP3DecInfo structure set to 0)
  *
- * Notes:       if one or more mallocs fail, function frees any buffers already
- *                allocated before returning
+ * Notes:       one malloc for the whole decoder, see InitBuffers
  **************************************************************************************/
 MP3DecInfo *AllocateBuffers(void)
 {
 	MP3DecInfo *mp3DecInfo;
-	FrameHeader *fh;
-	SideInfo *si;
-	ScaleFactorInfo *sfi;
-	HuffmanInfo *hi;
-	DequantInfo *di;
-	IMDCTInfo *mi;
-	SubbandInfo *sbi;
-
-	mp3DecInfo = (MP3DecInfo *)malloc(sizeof(MP3DecInfo));
-	if (!mp3DecInfo)
-		return 0;
-	ClearBuffer(mp3DecInfo, sizeof(MP3DecInfo));
-	
-	fh =  (FrameHeader *)     malloc(sizeof(FrameHeader));
-	si =  (SideInfo *)        malloc(sizeof(SideInfo));
-	sfi = (ScaleFactorInfo *) malloc(sizeof(ScaleFactorInfo));
-	hi =  (HuffmanInfo *)     malloc(sizeof(HuffmanInfo));
-	di =  (DequantInfo *)     malloc(sizeof(DequantInfo));
-	mi =  (IMDCTInfo *)       malloc(sizeof(IMDCTInfo));
-	sbi = (SubbandInfo *)     malloc(sizeof(SubbandInfo));
-
-	mp3DecInfo->FrameHeaderPS =     (void *)fh;
-	mp3DecInfo->SideInfoPS =        (void *)si;
-	mp3DecInfo->ScaleFactorInfoPS = (void *)sfi;
-	mp3DecInfo->HuffmanInfoPS =     (void *)hi;
-	mp3DecInfo->DequantInfoPS =     (void *)di;
-	mp3DecInfo->IMDCTInfoPS =       (void *)mi;
-	mp3DecInfo->SubbandInfoPS =     (void *)sbi;
-
-	if (!fh || !si || !sfi || !hi || !di || !mi || !sbi) {
-		FreeBuffers(mp3DecInfo);	/* safe to call - only frees memory that was successfully allocated */
+	void *buf;
+
+	buf = malloc(GetBufferSize());
+	if (!buf)
 		return 0;
-	}
 
-	/* important to do this - DSP primitives assume a bunch of state variables are 0 on first use */
-	ClearBuffer(fh,  sizeof(FrameHeader));
-	ClearBuffer(si,  sizeof(SideInfo));
-	ClearBuffer(sfi, sizeof(ScaleFactorInfo));
-	ClearBuffer(hi,  sizeof(HuffmanInfo));
-	ClearBuffer(di,  sizeof(DequantInfo));
-	ClearBuffer(mi,  sizeof(IMDCTInfo));
-	ClearBuffer(sbi, sizeof(SubbandInfo));
+	mp3DecInfo = InitBuffers(buf, GetBufferSize());
+	mp3DecInfo->allocBuf = buf;
 
 	return mp3DecInfo;
 }
 
-#define SAFE_FREE(x)	{if (x)	free(x);	(x) = 0;}	/* helper macro */
-
 /**************************************************************************************
  * Function:    FreeBuffers
  *
@@ -153,20 +227,12 @@ MP3DecInfo *AllocateBuffers(void)
  *
  * Return:      none
  *
- * Notes:       safe to call even if some buffers were not allocated (uses SAFE_FREE)
+ * Notes:       does nothing for decoders placed in caller memory by InitBuffers
  **************************************************************************************/
 void FreeBuffers(MP3DecInfo *mp3DecInfo)
 {
-	if (!mp3DecInfo)
+	if (!mp3DecInfo || !mp3DecInfo->allocBuf)
 		return;
 
-	SAFE_FREE(mp3DecInfo->FrameHeaderPS);
-	SAFE_FREE(mp3DecInfo->SideInfoPS);
-	SAFE_FREE(mp3DecInfo->ScaleFactorInfoPS);
-	SAFE_FREE(mp3DecInfo->HuffmanInfoPS);
-	SAFE_FREE(mp3DecInfo->DequantInfoPS);
-	SAFE_FREE(mp3DecInfo->IMDCTInfoPS);
-	SAFE_FREE(mp3DecInfo->SubbandInfoPS);
-
-	SAFE_FREE(mp3DecInfo);
+	free(mp3DecInfo->allocBuf);
 }
@@ -84,11 +84,24 @@
 #define	IMDCT_SCALE				2	/* additional scaling (by sqrt(2)) for fast IMDCT36 */
 
 #define	HUFF_PAIRTABS			32
+#define	HUFF_WIDE_BITS			10		/* index size of wide Huffman tables (see huffwide.c) */
 #define BLOCK_SIZE				18
 #define	NBANDS					32
 #define MAX_REORDER_SAMPS		((192-126)*3)		/* largest critical band for short blocks (see sfBandTable) */
 #define VBUF_LENGTH				(17 * 2 * NBANDS)	/* for double-sized vbuf FIFO */
 
+/* x86 SIMD kernels (real/x86) are built with gcc/clang target attributes, so no special
+ *   compiler flags are needed - define HELIX_NO_SIMD to build the C reference code only
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(HELIX_NO_SIMD)
+#define HELIX_X86_SIMD
+#endif
+
+/* flags returned by GetSIMDCaps() (x86/cpux86.c) */
+#define SIMD_SSE2				0x01
+#define SIMD_SSE41				0x02
+#define SIMD_AVX2				0x04
+
 /* additional external symbols to name-mangle for static linking */
 #define	SetBitstreamPointer	STATNAME(SetBitstreamPointer)
 #define	GetBits				STATNAME(GetBits)
@@ -99,7 +112,30 @@
 #define	IntensityProcMPEG2	STATNAME(IntensityProcMPEG2)
 #define PolyphaseMono		STATNAME(PolyphaseMono)
 #define PolyphaseStereo		STATNAME(PolyphaseStereo)
+#define PolyphaseMono32		STATNAME(PolyphaseMono32)
+#define PolyphaseStereo32	STATNAME(PolyphaseStereo32)
+#define PolyphaseMonoHalf	STATNAME(PolyphaseMonoHalf)
+#define PolyphaseMonoQuarter	STATNAME(PolyphaseMonoQuarter)
+#define PolyphaseStereoHalf	STATNAME(PolyphaseStereoHalf)
+#define PolyphaseStereoQuarter	STATNAME(PolyphaseStereoQuarter)
 #define FDCT32				STATNAME(FDCT32)
+#define FDCT32Output		STATNAME(FDCT32Output)
+#define PolyphaseMonoSSE41	STATNAME(PolyphaseMonoSSE41)
+#define PolyphaseStereoSSE41	STATNAME(PolyphaseStereoSSE41)
+#define PolyphaseMonoAVX2	STATNAME(PolyphaseMonoAVX2)
+#define PolyphaseStereoAVX2	STATNAME(PolyphaseStereoAVX2)
+#define FDCT32SSE41			STATNAME(FDCT32SSE41)
+#define FDCT32AVX2			STATNAME(FDCT32AVX2)
+#define IMDCT36xSSE41		STATNAME(IMDCT36xSSE41)
+#define IMDCT36xAVX2		STATNAME(IMDCT36xAVX2)
+#define FreqInvertRescaleSSE41	STATNAME(FreqInvertRescaleSSE41)
+#define FreqInvertRescaleAVX2	STATNAME(FreqInvertRescaleAVX2)
+#define AntiAliasSSE41		STATNAME(AntiAliasSSE41)
+#define AntiAliasAVX2		STATNAME(AntiAliasAVX2)
+#define DequantBlockAVX2	STATNAME(DequantBlockAVX2)
+#define MidSideProcSSE41	STATNAME(MidSideProcSSE41)
+#define IntensityRunSSE41	STATNAME(IntensityRunSSE41)
+#define IntensityRunAVX2	STATNAME(IntensityRunAVX2)
 
 #define	ISFMpeg1			STATNAME(ISFMpeg1)
 #define	ISFMpeg2			STATNAME(ISFMpeg2)
@@ -108,7 +144,22 @@
 #define	coef32				STATNAME(coef32)
 #define	polyCoef			STATNAME(polyCoef)
 #define	csa					STATNAME(csa)
+#define	pow14				STATNAME(pow14)
+#define	pow43_14			STATNAME(pow43_14)
+#define	pow43				STATNAME(pow43)
+#define	poly43lo			STATNAME(poly43lo)
+#define	poly43hi			STATNAME(poly43hi)
+#define	pow2exp				STATNAME(pow2exp)
+#define	pow2frac			STATNAME(pow2frac)
 #define	imdctWin			STATNAME(imdctWin)
+#define	c9_0				STATNAME(c9_0)
+#define	c9_1				STATNAME(c9_1)
+#define	c9_2				STATNAME(c9_2)
+#define	c9_3				STATNAME(c9_3)
+#define	c9_4				STATNAME(c9_4)
+#define	c18					STATNAME(c18)
+#define	fastWin36			STATNAME(fastWin36)
+#define	dcttab				STATNAME(dcttab)
 
 #define	huffTable			STATNAME(huffTable)
 #define	huffTabOffset		STATNAME(huffTabOffset)
@@ -116,6 +167,9 @@
 #define	quadTable			STATNAME(quadTable)
 #define	quadTabOffset		STATNAME(quadTabOffset)
 #define	quadTabMaxBits		STATNAME(quadTabMaxBits)
+#define	huffWideTable		STATNAME(huffWideTable)
+#define	huffWideOffset		STATNAME(huffWideOffset)
+#define	quadWideTable		STATNAME(quadWideTable)
 
 /* map these to the corresponding 2-bit values in the frame header */
 typedef enum {
@@ -125,9 +179,16 @@ typedef enum {
 	Mono = 0x03		/* one channel */
 } StereoMode;
 
+/* unsigned 64-bit type for the bitstream cache */
+#if defined(_WIN32) && !defined(__GNUC__)
+typedef unsigned __int64 BitCache64;
+#else
+typedef unsigned long long BitCache64;
+#endif
+
 typedef struct _BitStreamInfo {
 	unsigned char *bytePtr;
-	unsigned int iCache;
+	BitCache64 iCache;		/* left-justified, bits below cachedBits may be non-zero */
 	int cachedBits;
 	int nBytes;
 } BitStreamInfo;
@@ -183,8 +244,8 @@ typedef struct {
 } CriticalBandInfo;
 
 typedef struct _DequantInfo {
-	int workBuf[MAX_REORDER_SAMPS];		/* workbuf for reordering short blocks */
 	CriticalBandInfo cbi[MAX_NCHAN];	/* filled in dequantizer, used in joint stereo reconstruction */
+	int workBuf[MAX_REORDER_SAMPS];		/* workbuf for reordering short blocks (only touched for short blocks, so last) */
 } DequantInfo;
 
 typedef struct _HuffmanInfo {
@@ -215,6 +276,7 @@ typedef struct _IMDCTInfo {
 	int prevType[MAX_NCHAN];
 	int prevWinSwitch[MAX_NCHAN];
 	int gb[MAX_NCHAN];
+	int nBands[MAX_NCHAN];						/* outBuf blocks (subbands) which may be non-zero, all above are zero */
 } IMDCTInfo;
 
 typedef struct _BlockCount {
@@ -226,6 +288,8 @@ typedef struct _BlockCount {
 	int currWinSwitch;
 	int gbIn;
 	int gbOut;
+	int nBlocksClear;	/* in: blocks of y which may still hold last granule's output */
+	int nBlocksNonZero;	/* out: blocks of y which may be non-zero now */
 } BlockCount;
 
 /* max bits in scalefactors = 5, so use char's to save space */
@@ -253,6 +317,7 @@ typedef struct _ScaleFactorInfo {
 typedef struct _SubbandInfo {
 	int vbuf[MAX_NCHAN * VBUF_LENGTH];		/* vbuf for fast DCT-based synthesis PQMF - double size for speed (no modulo indexing) */
 	int vindex;								/* internal index for tracking position in vbuf */
+	int vbufZero[MAX_NCHAN];				/* this output channel's half of vbuf holds only zeros (silent last granule) */
 } SubbandInfo;
 
 /* bitstream.c */
@@ -262,16 +327,18 @@ int CalcBitsUsed(BitStreamInfo *bsi, unsigned char *startBuf, int startOffset);
 
 /* dequant.c, dqchan.c, stproc.c */
 int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader *fh, SideInfoSub *sis, 
-					ScaleFactorInfoSub *sfis, CriticalBandInfo *cbi);
+					ScaleFactorInfoSub *sfis, CriticalBandInfo *cbi, int simdCaps);
 void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2]);
 void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh, ScaleFactorInfoSub *sfis, 
-						CriticalBandInfo *cbi, int midSideFlag, int mixFlag, int mOut[2]);
+						CriticalBandInfo *cbi, int midSideFlag, int mixFlag, int mOut[2], int simdCaps);
 void IntensityProcMPEG2(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh, ScaleFactorInfoSub *sfis, 
-						CriticalBandInfo *cbi, ScaleFactorJS *sfjs, int midSideFlag, int mixFlag, int mOut[2]);
+						CriticalBandInfo *cbi, ScaleFactorJS *sfjs, int midSideFlag, int mixFlag, int mOut[2], int simdCaps);
 
 /* dct32.c */
 // about 1 ms faster in RAM, but very large
 void FDCT32(int *x, int *d, int offset, int oddBlock, int gb);// __attribute__ ((section (".data")));
+void FDCT32Output(int *x, int *d, int offset, int oddBlock, int es);
+extern const int dcttab[48];		/* also used by x86/dctsimd.c */
 
 /* hufftabs.c */
 extern const HuffTabLookup huffTabLookup[HUFF_PAIRTABS];
@@ -281,6 +348,11 @@ extern const unsigned char quadTable[64+16];
 extern const int quadTabOffset[2];
 extern const int quadTabMaxBits[2];
 
+/* huffwide.c */
+extern const unsigned int huffWideTable[15 << HUFF_WIDE_BITS];
+extern const int huffWideOffset[HUFF_PAIRTABS];
+extern const unsigned int quadWideTable[2 << HUFF_WIDE_BITS];
+
 /* polyphase.c (or asmpoly.s)
  * some platforms require a C++ compile of all source files,
  * so if we're compiling C as C++ and using native assembly
@@ -291,10 +363,60 @@ extern "C" {
 #endif
 void PolyphaseMono(short *pcm, int *vbuf, const int *coefBase);
 void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase);
+void PolyphaseMono32(int *pcm, int *vbuf, const int *coefBase, int outBits, int step);
+void PolyphaseStereo32(int *pcm, int *vbuf, const int *coefBase, int outBits, int step);
+void PolyphaseMonoHalf(short *pcm, int *vbuf, const int *coefBase);
+void PolyphaseMonoQuarter(short *pcm, int *vbuf, const int *coefBase);
+void PolyphaseStereoHalf(short *pcm, int *vbuf, const int *coefBase);
+void PolyphaseStereoQuarter(short *pcm, int *vbuf, const int *coefBase);
 #ifdef __cplusplus
 }
 #endif
 
+/* x86/polysimd.c - same output as polyphase.c, selected at run time in Subband() */
+#ifdef HELIX_X86_SIMD
+void PolyphaseMonoSSE41(short *pcm, int *vbuf, const int *coefBase);
+void PolyphaseStereoSSE41(short *pcm, int *vbuf, const int *coefBase);
+void PolyphaseMonoAVX2(short *pcm, int *vbuf, const int *coefBase);
+void PolyphaseStereoAVX2(short *pcm, int *vbuf, const int *coefBase);
+
+/* x86/dctsimd.c - same output as dct32.c */
+void FDCT32SSE41(int *x, int *d, int offset, int oddBlock, int gb);
+void FDCT32AVX2(int *x, int *d, int offset, int oddBlock, int gb);
+
+/* x86/imdctsimd.c - same output as IMDCT36() in imdct.c, for 4 or 8 adjacent long blocks, 
+ *   and as AntiAlias() and FreqInvertRescale()
+ */
+int IMDCT36xSSE41(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int gb);
+int IMDCT36xAVX2(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int gb);
+int FreqInvertRescaleSSE41(int y[BLOCK_SIZE][NBANDS], int *xPrev, int nBlocks, int es);
+int FreqInvertRescaleAVX2(int y[BLOCK_SIZE][NBANDS], int *xPrev, int nBlocks, int es);
+void AntiAliasSSE41(int *x, int nBfly);
+void AntiAliasAVX2(int *x, int nBfly);
+
+/* x86/dqsimd.c - same output as DequantBlock() in dqchan.c */
+int DequantBlockAVX2(int *inbuf, int *outbuf, int num, int scale);
+
+/* x86/stsimd.c - same output as MidSideProc() and IntensityRun() in stproc.c */
+void MidSideProcSSE41(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2]);
+void IntensityRunSSE41(int *x0, int *x1, int nSamps, const int fl[3], const int fr[3], int mOut[2]);
+void IntensityRunAVX2(int *x0, int *x1, int nSamps, const int fl[3], const int fr[3], int mOut[2]);
+#endif
+
+/* dqchan.c */
+extern int pow14[4];
+extern int pow43_14[4][16];
+extern int pow43[];
+extern int poly43lo[5];
+extern int poly43hi[5];
+extern int pow2exp[8];
+extern int pow2frac[8];
+
+/* imdct.c - also used by x86/imdctsimd.c */
+extern const int c9_0, c9_1, c9_2, c9_3, c9_4;
+extern const int c18[9];
+extern int fastWin36[18];
+
 /* trigtabs.c */
 extern const int imdctWin[4][36];
 extern const int ISFMpeg1[2][7];
@@ -81,8 +81,8 @@
 
 #define COS4_0  0x5a82799a	/* Q31 */
 
-// faster in ROM
-static const int dcttab[48] = {
+// faster in ROM (also used by x86/dctsimd.c)
+CACHE_ALIGNED const int dcttab[48] = {
 	/* first pass */
 	COS0_0, COS0_15, COS1_0,	/* 31, 27, 31 */
 	COS0_1, COS0_14, COS1_1,	/* 31, 29, 31 */
@@ -143,11 +143,10 @@ static const int dcttab[48] = {
 // about 1ms faster in RAM
 void FDCT32(int *buf, int *dest, int offset, int oddBlock, int gb)
 {
-    int i, s, tmp, es;
+    int i, es;
     const int *cptr = dcttab;
     int a0, a1, a2, a3, a4, a5, a6, a7;
     int b0, b1, b2, b3, b4, b5, b6, b7;
-	int *d;
 
 	/* scaling - ensure at least 6 guard bits for DCT 
 	 * (in practice this is already true 99% of time, so this code is
@@ -199,6 +198,31 @@ void FDCT32(int *buf, int *dest, int offset, int oddBlock, int gb)
 	}
 	buf -= 32;	/* reset */
 
+	FDCT32Output(buf, dest, offset, oddBlock, es);
+}
+
+/**************************************************************************************
+ * Function:    FDCT32Output
+ *
+ * Description: final stage of FDCT32, shuffles the DCT output into the polyphase 
+ *                filter input buffer
+ *
+ * Inputs:      DCT output buffer, length = 32 samples
+ *              buffer offset and oddblock flag for polyphase filter input buffer
+ *              extra shift (es) applied to the input of the DCT
+ *
+ * Outputs:     output buffer, data copied and interleaved for polyphase filter
+ *                (es undone with saturation)
+ *
+ * Return:      none
+ *
+ * Notes:       shared with the SIMD versions of FDCT32 in x86/dctsimd.c
+ **************************************************************************************/
+void FDCT32Output(int *buf, int *dest, int offset, int oddBlock, int es)
+{
+	int i, s, tmp;
+	int *d;
+
 	/* sample 0 - always delayed one block */
 	d = dest + 64*16 + ((offset - oddBlock) & 7) + (oddBlock ? 0 : VBUF_LENGTH);
 	s = buf[ 0];				d[0] = d[8] = s;
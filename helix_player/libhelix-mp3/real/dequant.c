@@ -97,8 +97,10 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr)
 
 	/* dequantize all the samples in each channel */
 	for (ch = 0; ch < mp3DecInfo->nChans; ch++) {
+		if (!CHANNEL_USED(mp3DecInfo, ch) && !fh->modeExt)
+			continue;	/* Huffman codes were skipped too */
 		hi->gb[ch] = DequantChannel(hi->huffDecBuf[ch], di->workBuf, &hi->nonZeroBound[ch], fh, 
-			&si->sis[gr][ch], &sfi->sfis[gr][ch], &cbi[ch]);
+			&si->sis[gr][ch], &sfi->sfis[gr][ch], &cbi[ch], mp3DecInfo->simdCaps);
 	}
 
 	/* joint stereo processing assumes one guard bit in input samples
@@ -129,6 +131,11 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr)
 			/* intensity stereo disabled - run mid-side on whole spectrum */
 			nSamps = MAX(hi->nonZeroBound[0], hi->nonZeroBound[1]);
 		}
+#ifdef HELIX_X86_SIMD
+		if (mp3DecInfo->simdCaps & SIMD_SSE41)
+			MidSideProcSSE41(hi->huffDecBuf, nSamps, mOut);
+		else
+#endif
 		MidSideProc(hi->huffDecBuf, nSamps, mOut);
 	}
 
@@ -137,10 +144,10 @@ int Dequantize(MP3DecInfo *mp3DecInfo, int gr)
 		nSamps = hi->nonZeroBound[0];
 		if (fh->ver == MPEG1) {
 			IntensityProcMPEG1(hi->huffDecBuf, nSamps, fh, &sfi->sfis[gr][1], di->cbi, 
-				fh->modeExt >> 1, si->sis[gr][1].mixedBlock, mOut);
+				fh->modeExt >> 1, si->sis[gr][1].mixedBlock, mOut, mp3DecInfo->simdCaps);
 		} else {
 			IntensityProcMPEG2(hi->huffDecBuf, nSamps, fh, &sfi->sfis[gr][1], di->cbi, &sfi->sfjs,
-				fh->modeExt >> 1, si->sis[gr][1].mixedBlock, mOut);
+				fh->modeExt >> 1, si->sis[gr][1].mixedBlock, mOut, mp3DecInfo->simdCaps);
 		}
 	}
 
@@ -45,6 +45,7 @@
 #include "assembly.h"
 
 typedef int ARRAY3[3];	/* for short-block reordering */
+typedef int (*DequantBlockFunc)(int *inbuf, int *outbuf, int num, int scale);
 
 /* optional pre-emphasis for high-frequency scale factor bands */
 static const char preTab[22] = { 0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,2,2,3,3,3,2,0 };
@@ -55,7 +56,7 @@ int pow14[4] = {
 };
 
 /* pow(2,-i/4) * pow(j,4/3) for i=0..3 j=0..15, Q25 format */
-int pow43_14[4][16] = {
+CACHE_ALIGNED int pow43_14[4][16] = {
 {	0x00000000, 0x10000000, 0x285145f3, 0x453a5cdb, /* Q28 */
 	0x0cb2ff53, 0x111989d6, 0x15ce31c8, 0x1ac7f203, 
 	0x20000000, 0x257106b9, 0x2b16b4a3, 0x30ed74b4, 
@@ -78,7 +79,7 @@ int pow43_14[4][16] = {
 };
 
 /* pow(j,4/3) for j=16..63, Q23 format */
-int pow43[] = {
+CACHE_ALIGNED int pow43[] = {
 	0x1428a2fa, 0x15db1bd6, 0x1796302c, 0x19598d85, 
 	0x1b24e8bb, 0x1cf7fcfa, 0x1ed28af2, 0x20b4582a, 
 	0x229d2e6e, 0x248cdb55, 0x26832fda, 0x28800000, 
@@ -232,6 +233,7 @@ static int DequantBlock(int *inbuf, int *outbuf, int num, int scale)
  *              non-zero bound for this channel/granule
  *              valid FrameHeader, SideInfoSub, ScaleFactorInfoSub, and CriticalBandInfo
  *                structures for this channel/granule
+ *              SIMD_xxx flags (uses the x86 SIMD DequantBlock() if available)
  *
  * Outputs:     MAX_NSAMP dequantized samples in sampleBuf
  *              updated non-zero bound (indicating which samples are != 0 after DQ)
@@ -242,7 +244,7 @@ static int DequantBlock(int *inbuf, int *outbuf, int num, int scale)
  * Notes:       dequantized samples in Q(DQ_FRACBITS_OUT) format 
  **************************************************************************************/
 int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader *fh, SideInfoSub *sis, 
-					ScaleFactorInfoSub *sfis, CriticalBandInfo *cbi)
+					ScaleFactorInfoSub *sfis, CriticalBandInfo *cbi, int simdCaps)
 {
 	int i, j, w, cb;
 	int cbStartL, cbEndL, cbStartS, cbEndS;
@@ -250,6 +252,13 @@ int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader
 	int globalGain, gainI;
 	int cbMax[3];
 	ARRAY3 *buf;    /* short block reorder */
+	DequantBlockFunc dequantBlock;
+
+	dequantBlock = DequantBlock;
+#ifdef HELIX_X86_SIMD
+	if (simdCaps & SIMD_AVX2)
+		dequantBlock = DequantBlockAVX2;
+#endif
 	
 	/* set default start/end points for short/long blocks - will update with non-zero cb info */
 	if (sis->blockType == 2) {
@@ -295,7 +304,7 @@ int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader
 		nSamps = fh->sfBand->l[cb + 1] - fh->sfBand->l[cb];
 		gainI = 210 - globalGain + sfactMultiplier * (sfis->l[cb] + (sis->preFlag ? (int)preTab[cb] : 0));
 
-		nonZero |= DequantBlock(sampleBuf + i, sampleBuf + i, nSamps, gainI);
+		nonZero |= dequantBlock(sampleBuf + i, sampleBuf + i, nSamps, gainI);
 		i += nSamps;
 
 		/* update highest non-zero critical band */
@@ -326,7 +335,7 @@ int DequantChannel(int *sampleBuf, int *workBuf, int *nonZeroBound, FrameHeader
 			nonZero =  0;
 			gainI = 210 - globalGain + 8*sis->subBlockGain[w] + sfactMultiplier*(sfis->s[cb][w]);
 
-			nonZero |= DequantBlock(sampleBuf + i + nSamps*w, workBuf + nSamps*w, nSamps, gainI);
+			nonZero |= dequantBlock(sampleBuf + i + nSamps*w, workBuf + nSamps*w, nSamps, gainI);
 
 			/* update highest non-zero critical band */
 			if (nonZero)
@@ -56,6 +56,15 @@
 #define GetCWXQ(x)      ((int)( (((unsigned char)(x)) >> 1) & 0x01))
 #define GetCWYQ(x)      ((int)( (((unsigned char)(x)) >> 0) & 0x01))
 
+#define GetWideLen1(x)  ((int)( ((x) >>  0) & 0x0f))
+#define GetWideLen2(x)  ((int)( ((x) >>  4) & 0x0f))
+
+/* value n (x0, y0, x1, y1) from a wide pair table entry, with sign in MSB */
+#define GetWideVal(x, n)	((int)( (((x) >> (28 - 4*(n))) & 0x0f) | (((x) << (16 + (n))) & 0x80000000) ))
+
+/* value n (v, w, x, y) of quad q from a wide quad table entry, with sign in MSB */
+#define GetWideQuad(x, q, n)	((int)( (((x) >> (31 - 8*(q) - (n))) & 0x01) | (((x) << (4 + 8*(q) + (n))) & 0x80000000) ))
+
 /* apply sign of s to the positive number x (save in MSB, will do two's complement in dequant) */
 #define ApplySign(x, s)	{ (x) |= ((s) & 0x80000000); }
 
@@ -78,6 +87,9 @@
  * Notes:       assumes that nVals is an even number
  *              si_huff.bit tests every Huffman codeword in every table (though not
  *                necessarily all linBits outputs for x,y > 15)
+ *              tries huffWideTable first, which decodes one or two whole pairs (with 
+ *                sign bits) per lookup, and only walks huffTable if the next pair 
+ *                doesn't fit in HUFF_WIDE_BITS or needs linBits
  **************************************************************************************/
 // no improvement with section=data
 static int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsigned char *buf, int bitOffset)
@@ -86,7 +98,8 @@ static int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsi
 	int cachedBits, padBits, len, startBits, linBits, maxBits, minBits;
 	HuffTabType tabType;
 	unsigned short cw, *tBase, *tCurr;
-	unsigned int cache;
+	unsigned int cache, wide;
+	const unsigned int *tWide;
 
 	if(nVals <= 0) 
 		return 0;
@@ -98,6 +111,7 @@ static int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsi
 	tBase = (unsigned short *)(huffTable + huffTabOffset[tabIdx]);
 	linBits = huffTabLookup[tabIdx].linBits;
 	tabType = huffTabLookup[tabIdx].tabType;
+	tWide = huffWideTable + huffWideOffset[tabIdx];
 
 	ASSERT(!(nVals & 0x01));
 	ASSERT(tabIdx < HUFF_PAIRTABS);
@@ -146,6 +160,24 @@ static int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsi
 
 			/* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
 			while (nVals > 0 && cachedBits >= 11 ) {
+				/* one or two pairs from the wide table, unless that would use any padBits */
+				wide = tWide[cache >> (32 - HUFF_WIDE_BITS)];
+				len = GetWideLen1(wide);
+				if (len && cachedBits - len >= padBits) {
+					*xy++ = GetWideVal(wide, 0);
+					*xy++ = GetWideVal(wide, 1);
+					nVals -= 2;
+					if (GetWideLen2(wide) && nVals > 0 && cachedBits - len - GetWideLen2(wide) >= padBits) {
+						*xy++ = GetWideVal(wide, 2);
+						*xy++ = GetWideVal(wide, 3);
+						nVals -= 2;
+						len += GetWideLen2(wide);
+					}
+					cachedBits -= len;
+					cache <<= len;
+					continue;
+				}
+
 				cw = tBase[cache >> (32 - maxBits)];
 				len = GetHLen(cw);
 				cachedBits -= len;
@@ -191,6 +223,25 @@ static int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsi
 
 			/* largest maxBits = 9, plus 2 for sign bits, so make sure cache has at least 11 bits */
 			while (nVals > 0 && cachedBits >= 11 ) {
+				/* one or two pairs from the wide table, unless that would use any padBits
+				 *   (only at the start of a codeword - tCurr != tBase part way through a long one) */
+				wide = tWide[cache >> (32 - HUFF_WIDE_BITS)];
+				len = GetWideLen1(wide);
+				if (tCurr == tBase && len && cachedBits - len >= padBits) {
+					*xy++ = GetWideVal(wide, 0);
+					*xy++ = GetWideVal(wide, 1);
+					nVals -= 2;
+					if (GetWideLen2(wide) && nVals > 0 && cachedBits - len - GetWideLen2(wide) >= padBits) {
+						*xy++ = GetWideVal(wide, 2);
+						*xy++ = GetWideVal(wide, 3);
+						nVals -= 2;
+						len += GetWideLen2(wide);
+					}
+					cachedBits -= len;
+					cache <<= len;
+					continue;
+				}
+
 				maxBits = GetMaxbits(tCurr[0]);
 				cw = tCurr[(cache >> (32 - maxBits)) + 1];
 				len = GetHLen(cw);
@@ -282,20 +333,24 @@ static int DecodeHuffmanPairs(int *xy, int nVals, int tabIdx, int bitsLeft, unsi
  *                of the quad word after which all samples are 0)
  * 
  * Notes:        si_huff.bit tests every vwxy output in both quad tables
+ *              every quad fits in HUFF_WIDE_BITS, so quadWideTable gives one or two 
+ *                whole quads per lookup, and quadTable is only used to detect the end
  **************************************************************************************/
 // no improvement with section=data
 static int DecodeHuffmanQuads(int *vwxy, int nVals, int tabIdx, int bitsLeft, unsigned char *buf, int bitOffset)
 {
 	int i, v, w, x, y;
 	int len, maxBits, cachedBits, padBits;
-	unsigned int cache;
+	unsigned int cache, wide;
 	unsigned char cw, *tBase;
+	const unsigned int *tWide;
 
 	if (bitsLeft <= 0)
 		return 0;
 
 	tBase = (unsigned char *)quadTable + quadTabOffset[tabIdx];
 	maxBits = quadTabMaxBits[tabIdx];
+	tWide = quadWideTable + (tabIdx << HUFF_WIDE_BITS);
 
 	/* initially fill cache with any partial byte */
 	cache = 0;
@@ -328,6 +383,28 @@ static int DecodeHuffmanQuads(int *vwxy, int nVals, int tabIdx, int bitsLeft, un
 
 		/* largest maxBits = 6, plus 4 for sign bits, so make sure cache has at least 10 bits */
 		while (i < (nVals - 3) && cachedBits >= 10 ) {
+			/* one or two quads from the wide table, unless that would use any padBits */
+			wide = tWide[cache >> (32 - HUFF_WIDE_BITS)];
+			len = GetWideLen1(wide);
+			if (cachedBits - len >= padBits) {
+				*vwxy++ = GetWideQuad(wide, 0, 0);
+				*vwxy++ = GetWideQuad(wide, 0, 1);
+				*vwxy++ = GetWideQuad(wide, 0, 2);
+				*vwxy++ = GetWideQuad(wide, 0, 3);
+				i += 4;
+				if (GetWideLen2(wide) && i < (nVals - 3) && cachedBits - len - GetWideLen2(wide) >= padBits) {
+					*vwxy++ = GetWideQuad(wide, 1, 0);
+					*vwxy++ = GetWideQuad(wide, 1, 1);
+					*vwxy++ = GetWideQuad(wide, 1, 2);
+					*vwxy++ = GetWideQuad(wide, 1, 3);
+					i += 4;
+					len += GetWideLen2(wide);
+				}
+				cachedBits -= len;
+				cache <<= len;
+				continue;
+			}
+
 			cw = tBase[cache >> (32 - maxBits)];
 			len = GetHLenQ(cw);
 			cachedBits -= len;
@@ -402,6 +479,14 @@ int DecodeHuffman(MP3DecInfo *mp3DecInfo, unsigned char *buf, int *bitOffset, in
 	if (huffBlockBits < 0)
 		return -1;
 
+	/* channel not wanted (see MP3SetChannelMode) and not needed for stereo processing - skip its codes */
+	if (!CHANNEL_USED(mp3DecInfo, ch) && !fh->modeExt) {
+		hi->nonZeroBound[ch] = 0;
+		buf += (huffBlockBits + *bitOffset) >> 3;
+		*bitOffset = (huffBlockBits + *bitOffset) & 0x07;
+		return (buf - startBuf);
+	}
+
 	/* figure out region boundaries (the first 2*bigVals coefficients divided into 3 regions) */
 	if (sis->winSwitchFlag && sis->blockType == 2) {
 		if (sis->mixedBlock == 0) {
@@ -661,7 +661,7 @@ const unsigned short huffTable[] = {
 #define HUFF_OFFSET_16	(580 + HUFF_OFFSET_15)
 #define HUFF_OFFSET_24	(651 + HUFF_OFFSET_16)
 
-const int huffTabOffset[HUFF_PAIRTABS] = {
+CACHE_ALIGNED const int huffTabOffset[HUFF_PAIRTABS] = {
 	0,          
 	HUFF_OFFSET_01,
 	HUFF_OFFSET_02,
@@ -696,7 +696,7 @@ const int huffTabOffset[HUFF_PAIRTABS] = {
 	HUFF_OFFSET_24,
 };
 
-const HuffTabLookup huffTabLookup[HUFF_PAIRTABS] = {
+CACHE_ALIGNED const HuffTabLookup huffTabLookup[HUFF_PAIRTABS] = {
 	{ 0,  noBits },
 	{ 0,  oneShot },
 	{ 0,  oneShot },
@@ -736,7 +736,7 @@ const HuffTabLookup huffTabLookup[HUFF_PAIRTABS] = {
  *  A = length of codeword
  *  B = codeword
  */
-const unsigned char quadTable[64+16] = {
+CACHE_ALIGNED const unsigned char quadTable[64+16] = {
 	/* table A */
 	0x6b, 0x6f, 0x6d, 0x6e, 0x67, 0x65, 0x59, 0x59, 
 	0x56, 0x56, 0x53, 0x53, 0x5a, 0x5a, 0x5c, 0x5c, 
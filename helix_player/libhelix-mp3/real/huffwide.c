@@ -0,0 +1,2313 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * huffwide.c - wide Huffman lookup tables (up to two pairs or quads per lookup)
+ **************************************************************************************/
+
+#include "coder.h"
+
+/* generated from huffTable[] and quadTable[] in hufftabs.c
+ *
+ * each table is indexed by the next HUFF_WIDE_BITS bits of the stream, and gives all the 
+ *   codewords (including their sign bits) which fit completely in those bits, up to two
+ *
+ * pair tables, format 0xABCDEFGH
+ *  A, B = x, y of first pair
+ *  C, D = x, y of second pair
+ *  E    = sign bits (x0, y0, x1, y1 from MSB to LSB)
+ *  F    = unused (0)
+ *  G    = length of second pair (0 if it doesn't fit)
+ *  H    = length of first pair (0 if it doesn't fit - use huffTable instead)
+ *  pairs with x or y = 15 in tables with linbits are never included (need escape bits)
+ *
+ * quad tables, format 0xABCDEFGH
+ *  A, B = vwxy (one bit each) and sign bits of first quad
+ *  C, D = vwxy and sign bits of second quad
+ *  E, F = unused (0)
+ *  G, H = length of second and first quad, as above (every first quad fits)
+ */
+CACHE_ALIGNED const unsigned int huffWideTable[15 << HUFF_WIDE_BITS] = {
+	/* huffWideTable01[1024] */
+	0x11110055, 0x11111055, 0x11112055, 0x11113055, 0x11010045, 0x11010045, 0x11011045, 0x11011045,
+	0x11100035, 0x11100035, 0x11100035, 0x11100035, 0x11102035, 0x11102035, 0x11102035, 0x11102035,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x11114055, 0x11115055, 0x11116055, 0x11117055, 0x11014045, 0x11014045, 0x11015045, 0x11015045,
+	0x11104035, 0x11104035, 0x11104035, 0x11104035, 0x11106035, 0x11106035, 0x11106035, 0x11106035,
+	0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015,
+	0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015,
+	0x11118055, 0x11119055, 0x1111a055, 0x1111b055, 0x11018045, 0x11018045, 0x11019045, 0x11019045,
+	0x11108035, 0x11108035, 0x11108035, 0x11108035, 0x1110a035, 0x1110a035, 0x1110a035, 0x1110a035,
+	0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015,
+	0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015,
+	0x1111c055, 0x1111d055, 0x1111e055, 0x1111f055, 0x1101c045, 0x1101c045, 0x1101d045, 0x1101d045,
+	0x1110c035, 0x1110c035, 0x1110c035, 0x1110c035, 0x1110e035, 0x1110e035, 0x1110e035, 0x1110e035,
+	0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015,
+	0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015,
+	0x01110054, 0x01110054, 0x01111054, 0x01111054, 0x01112054, 0x01112054, 0x01113054, 0x01113054,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100034, 0x01100034, 0x01100034, 0x01100034, 0x01100034, 0x01100034, 0x01100034, 0x01100034,
+	0x01102034, 0x01102034, 0x01102034, 0x01102034, 0x01102034, 0x01102034, 0x01102034, 0x01102034,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01114054, 0x01114054, 0x01115054, 0x01115054, 0x01116054, 0x01116054, 0x01117054, 0x01117054,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104034, 0x01104034, 0x01104034, 0x01104034, 0x01104034, 0x01104034, 0x01104034, 0x01104034,
+	0x01106034, 0x01106034, 0x01106034, 0x01106034, 0x01106034, 0x01106034, 0x01106034, 0x01106034,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x10110053, 0x10110053, 0x10110053, 0x10110053, 0x10111053, 0x10111053, 0x10111053, 0x10111053,
+	0x10112053, 0x10112053, 0x10112053, 0x10112053, 0x10113053, 0x10113053, 0x10113053, 0x10113053,
+	0x10010043, 0x10010043, 0x10010043, 0x10010043, 0x10010043, 0x10010043, 0x10010043, 0x10010043,
+	0x10011043, 0x10011043, 0x10011043, 0x10011043, 0x10011043, 0x10011043, 0x10011043, 0x10011043,
+	0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033,
+	0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033, 0x10100033,
+	0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033,
+	0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033, 0x10102033,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013, 0x10000013,
+	0x10118053, 0x10118053, 0x10118053, 0x10118053, 0x10119053, 0x10119053, 0x10119053, 0x10119053,
+	0x1011a053, 0x1011a053, 0x1011a053, 0x1011a053, 0x1011b053, 0x1011b053, 0x1011b053, 0x1011b053,
+	0x10018043, 0x10018043, 0x10018043, 0x10018043, 0x10018043, 0x10018043, 0x10018043, 0x10018043,
+	0x10019043, 0x10019043, 0x10019043, 0x10019043, 0x10019043, 0x10019043, 0x10019043, 0x10019043,
+	0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033,
+	0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033, 0x10108033,
+	0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033,
+	0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033, 0x1010a033,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013, 0x10008013,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051,
+	0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051,
+	0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051,
+	0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051,
+	0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051,
+	0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031, 0x00100031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031, 0x00102031,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* huffWideTable02[1024] */
+	0x22000008, 0x22000008, 0x22000018, 0x22000018, 0x22004008, 0x22004008, 0x22004018, 0x22004018,
+	0x22008008, 0x22008008, 0x22008018, 0x22008018, 0x2200c008, 0x2200c008, 0x2200c018, 0x2200c018,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000017, 0x02000017, 0x02000017, 0x02000017,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004017, 0x02004017, 0x02004017, 0x02004017,
+	0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000017, 0x12000017, 0x12000017, 0x12000017,
+	0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004017, 0x12004017, 0x12004017, 0x12004017,
+	0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008017, 0x12008017, 0x12008017, 0x12008017,
+	0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c017, 0x1200c017, 0x1200c017, 0x1200c017,
+	0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000017, 0x21000017, 0x21000017, 0x21000017,
+	0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004017, 0x21004017, 0x21004017, 0x21004017,
+	0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008017, 0x21008017, 0x21008017, 0x21008017,
+	0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c017, 0x2100c017, 0x2100c017, 0x2100c017,
+	0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20010046, 0x20011046, 0x20100046, 0x20102046,
+	0x20000016, 0x20000016, 0x20000016, 0x20000016, 0x20000016, 0x20000016, 0x20000016, 0x20000016,
+	0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20018046, 0x20019046, 0x20108046, 0x2010a046,
+	0x20008016, 0x20008016, 0x20008016, 0x20008016, 0x20008016, 0x20008016, 0x20008016, 0x20008016,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11110055, 0x11111055, 0x11112055, 0x11113055,
+	0x11010045, 0x11010045, 0x11011045, 0x11011045, 0x11100045, 0x11100045, 0x11102045, 0x11102045,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11114055, 0x11115055, 0x11116055, 0x11117055,
+	0x11014045, 0x11014045, 0x11015045, 0x11015045, 0x11104045, 0x11104045, 0x11106045, 0x11106045,
+	0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015,
+	0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11118055, 0x11119055, 0x1111a055, 0x1111b055,
+	0x11018045, 0x11018045, 0x11019045, 0x11019045, 0x11108045, 0x11108045, 0x1110a045, 0x1110a045,
+	0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015,
+	0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1111c055, 0x1111d055, 0x1111e055, 0x1111f055,
+	0x1101c045, 0x1101c045, 0x1101d045, 0x1101d045, 0x1110c045, 0x1110c045, 0x1110e045, 0x1110e045,
+	0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015,
+	0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01200064, 0x01202064,
+	0x01110054, 0x01110054, 0x01111054, 0x01111054, 0x01112054, 0x01112054, 0x01113054, 0x01113054,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01204064, 0x01206064,
+	0x01114054, 0x01114054, 0x01115054, 0x01115054, 0x01116054, 0x01116054, 0x01117054, 0x01117054,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10200064, 0x10202064,
+	0x10110054, 0x10110054, 0x10111054, 0x10111054, 0x10112054, 0x10112054, 0x10113054, 0x10113054,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10208064, 0x1020a064,
+	0x10118054, 0x10118054, 0x10119054, 0x10119054, 0x1011a054, 0x1011a054, 0x1011b054, 0x1011b054,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x00220081, 0x00220081, 0x00221081, 0x00221081, 0x00222081, 0x00222081, 0x00223081, 0x00223081,
+	0x00020071, 0x00020071, 0x00020071, 0x00020071, 0x00021071, 0x00021071, 0x00021071, 0x00021071,
+	0x00120071, 0x00120071, 0x00120071, 0x00120071, 0x00121071, 0x00121071, 0x00121071, 0x00121071,
+	0x00122071, 0x00122071, 0x00122071, 0x00122071, 0x00123071, 0x00123071, 0x00123071, 0x00123071,
+	0x00210071, 0x00210071, 0x00210071, 0x00210071, 0x00211071, 0x00211071, 0x00211071, 0x00211071,
+	0x00212071, 0x00212071, 0x00212071, 0x00212071, 0x00213071, 0x00213071, 0x00213071, 0x00213071,
+	0x00200061, 0x00200061, 0x00200061, 0x00200061, 0x00200061, 0x00200061, 0x00200061, 0x00200061,
+	0x00202061, 0x00202061, 0x00202061, 0x00202061, 0x00202061, 0x00202061, 0x00202061, 0x00202061,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051,
+	0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051,
+	0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051,
+	0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051,
+	0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051,
+	0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* huffWideTable03[1024] */
+	0x22000008, 0x22000008, 0x22000008, 0x22000028, 0x22004008, 0x22004008, 0x22004008, 0x22004028,
+	0x22008008, 0x22008008, 0x22008008, 0x22008028, 0x2200c008, 0x2200c008, 0x2200c008, 0x2200c028,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02010037, 0x02011037, 0x02000027, 0x02000027,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02014037, 0x02015037, 0x02004027, 0x02004027,
+	0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12010037, 0x12011037, 0x12000027, 0x12000027,
+	0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12014037, 0x12015037, 0x12004027, 0x12004027,
+	0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12018037, 0x12019037, 0x12008027, 0x12008027,
+	0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1201c037, 0x1201d037, 0x1200c027, 0x1200c027,
+	0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21010037, 0x21011037, 0x21000027, 0x21000027,
+	0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21014037, 0x21015037, 0x21004027, 0x21004027,
+	0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21018037, 0x21019037, 0x21008027, 0x21008027,
+	0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2101c037, 0x2101d037, 0x2100c027, 0x2100c027,
+	0x20000006, 0x20000006, 0x20100046, 0x20102046, 0x20110046, 0x20111046, 0x20112046, 0x20113046,
+	0x20010036, 0x20010036, 0x20011036, 0x20011036, 0x20000026, 0x20000026, 0x20000026, 0x20000026,
+	0x20008006, 0x20008006, 0x20108046, 0x2010a046, 0x20118046, 0x20119046, 0x2011a046, 0x2011b046,
+	0x20018036, 0x20018036, 0x20019036, 0x20019036, 0x20008026, 0x20008026, 0x20008026, 0x20008026,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10200064, 0x10202064,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10110044, 0x10110044, 0x10110044, 0x10110044, 0x10111044, 0x10111044, 0x10111044, 0x10111044,
+	0x10112044, 0x10112044, 0x10112044, 0x10112044, 0x10113044, 0x10113044, 0x10113044, 0x10113044,
+	0x10010034, 0x10010034, 0x10010034, 0x10010034, 0x10010034, 0x10010034, 0x10010034, 0x10010034,
+	0x10011034, 0x10011034, 0x10011034, 0x10011034, 0x10011034, 0x10011034, 0x10011034, 0x10011034,
+	0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024,
+	0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10208064, 0x1020a064,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10118044, 0x10118044, 0x10118044, 0x10118044, 0x10119044, 0x10119044, 0x10119044, 0x10119044,
+	0x1011a044, 0x1011a044, 0x1011a044, 0x1011a044, 0x1011b044, 0x1011b044, 0x1011b044, 0x1011b044,
+	0x10018034, 0x10018034, 0x10018034, 0x10018034, 0x10018034, 0x10018034, 0x10018034, 0x10018034,
+	0x10019034, 0x10019034, 0x10019034, 0x10019034, 0x10019034, 0x10019034, 0x10019034, 0x10019034,
+	0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024,
+	0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024,
+	0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11200064, 0x11202064,
+	0x11100044, 0x11100044, 0x11100044, 0x11100044, 0x11102044, 0x11102044, 0x11102044, 0x11102044,
+	0x11110044, 0x11110044, 0x11110044, 0x11110044, 0x11111044, 0x11111044, 0x11111044, 0x11111044,
+	0x11112044, 0x11112044, 0x11112044, 0x11112044, 0x11113044, 0x11113044, 0x11113044, 0x11113044,
+	0x11010034, 0x11010034, 0x11010034, 0x11010034, 0x11010034, 0x11010034, 0x11010034, 0x11010034,
+	0x11011034, 0x11011034, 0x11011034, 0x11011034, 0x11011034, 0x11011034, 0x11011034, 0x11011034,
+	0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024,
+	0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024,
+	0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11204064, 0x11206064,
+	0x11104044, 0x11104044, 0x11104044, 0x11104044, 0x11106044, 0x11106044, 0x11106044, 0x11106044,
+	0x11114044, 0x11114044, 0x11114044, 0x11114044, 0x11115044, 0x11115044, 0x11115044, 0x11115044,
+	0x11116044, 0x11116044, 0x11116044, 0x11116044, 0x11117044, 0x11117044, 0x11117044, 0x11117044,
+	0x11014034, 0x11014034, 0x11014034, 0x11014034, 0x11014034, 0x11014034, 0x11014034, 0x11014034,
+	0x11015034, 0x11015034, 0x11015034, 0x11015034, 0x11015034, 0x11015034, 0x11015034, 0x11015034,
+	0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024,
+	0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024,
+	0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11208064, 0x1120a064,
+	0x11108044, 0x11108044, 0x11108044, 0x11108044, 0x1110a044, 0x1110a044, 0x1110a044, 0x1110a044,
+	0x11118044, 0x11118044, 0x11118044, 0x11118044, 0x11119044, 0x11119044, 0x11119044, 0x11119044,
+	0x1111a044, 0x1111a044, 0x1111a044, 0x1111a044, 0x1111b044, 0x1111b044, 0x1111b044, 0x1111b044,
+	0x11018034, 0x11018034, 0x11018034, 0x11018034, 0x11018034, 0x11018034, 0x11018034, 0x11018034,
+	0x11019034, 0x11019034, 0x11019034, 0x11019034, 0x11019034, 0x11019034, 0x11019034, 0x11019034,
+	0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024,
+	0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024,
+	0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1120c064, 0x1120e064,
+	0x1110c044, 0x1110c044, 0x1110c044, 0x1110c044, 0x1110e044, 0x1110e044, 0x1110e044, 0x1110e044,
+	0x1111c044, 0x1111c044, 0x1111c044, 0x1111c044, 0x1111d044, 0x1111d044, 0x1111d044, 0x1111d044,
+	0x1111e044, 0x1111e044, 0x1111e044, 0x1111e044, 0x1111f044, 0x1111f044, 0x1111f044, 0x1111f044,
+	0x1101c034, 0x1101c034, 0x1101c034, 0x1101c034, 0x1101c034, 0x1101c034, 0x1101c034, 0x1101c034,
+	0x1101d034, 0x1101d034, 0x1101d034, 0x1101d034, 0x1101d034, 0x1101d034, 0x1101d034, 0x1101d034,
+	0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024,
+	0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024,
+	0x01000003, 0x01000003, 0x01020073, 0x01021073, 0x01120073, 0x01121073, 0x01122073, 0x01123073,
+	0x01210073, 0x01211073, 0x01212073, 0x01213073, 0x01200063, 0x01200063, 0x01202063, 0x01202063,
+	0x01100043, 0x01100043, 0x01100043, 0x01100043, 0x01100043, 0x01100043, 0x01100043, 0x01100043,
+	0x01102043, 0x01102043, 0x01102043, 0x01102043, 0x01102043, 0x01102043, 0x01102043, 0x01102043,
+	0x01110043, 0x01110043, 0x01110043, 0x01110043, 0x01110043, 0x01110043, 0x01110043, 0x01110043,
+	0x01111043, 0x01111043, 0x01111043, 0x01111043, 0x01111043, 0x01111043, 0x01111043, 0x01111043,
+	0x01112043, 0x01112043, 0x01112043, 0x01112043, 0x01112043, 0x01112043, 0x01112043, 0x01112043,
+	0x01113043, 0x01113043, 0x01113043, 0x01113043, 0x01113043, 0x01113043, 0x01113043, 0x01113043,
+	0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033,
+	0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033, 0x01010033,
+	0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033,
+	0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033, 0x01011033,
+	0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023,
+	0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023,
+	0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023,
+	0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023, 0x01000023,
+	0x01004003, 0x01004003, 0x01024073, 0x01025073, 0x01124073, 0x01125073, 0x01126073, 0x01127073,
+	0x01214073, 0x01215073, 0x01216073, 0x01217073, 0x01204063, 0x01204063, 0x01206063, 0x01206063,
+	0x01104043, 0x01104043, 0x01104043, 0x01104043, 0x01104043, 0x01104043, 0x01104043, 0x01104043,
+	0x01106043, 0x01106043, 0x01106043, 0x01106043, 0x01106043, 0x01106043, 0x01106043, 0x01106043,
+	0x01114043, 0x01114043, 0x01114043, 0x01114043, 0x01114043, 0x01114043, 0x01114043, 0x01114043,
+	0x01115043, 0x01115043, 0x01115043, 0x01115043, 0x01115043, 0x01115043, 0x01115043, 0x01115043,
+	0x01116043, 0x01116043, 0x01116043, 0x01116043, 0x01116043, 0x01116043, 0x01116043, 0x01116043,
+	0x01117043, 0x01117043, 0x01117043, 0x01117043, 0x01117043, 0x01117043, 0x01117043, 0x01117043,
+	0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033,
+	0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033, 0x01014033,
+	0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033,
+	0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033, 0x01015033,
+	0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023,
+	0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023,
+	0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023,
+	0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023, 0x01004023,
+	0x00220082, 0x00221082, 0x00222082, 0x00223082, 0x00020072, 0x00020072, 0x00021072, 0x00021072,
+	0x00120072, 0x00120072, 0x00121072, 0x00121072, 0x00122072, 0x00122072, 0x00123072, 0x00123072,
+	0x00210072, 0x00210072, 0x00211072, 0x00211072, 0x00212072, 0x00212072, 0x00213072, 0x00213072,
+	0x00200062, 0x00200062, 0x00200062, 0x00200062, 0x00202062, 0x00202062, 0x00202062, 0x00202062,
+	0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042,
+	0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042,
+	0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042,
+	0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042,
+	0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042,
+	0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042,
+	0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042,
+	0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042,
+	0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042,
+	0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042,
+	0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042,
+	0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042,
+	0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032,
+	0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032,
+	0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032,
+	0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032, 0x00010032,
+	0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032,
+	0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032,
+	0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032,
+	0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032, 0x00011032,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	/* huffWideTable05[1024] */
+	0x3300000a, 0x3300400a, 0x3300800a, 0x3300c00a, 0x2300000a, 0x2300400a, 0x2300800a, 0x2300c00a,
+	0x32000009, 0x32000019, 0x32004009, 0x32004019, 0x32008009, 0x32008019, 0x3200c009, 0x3200c019,
+	0x31000008, 0x31000008, 0x31000018, 0x31000018, 0x31004008, 0x31004008, 0x31004018, 0x31004018,
+	0x31008008, 0x31008008, 0x31008018, 0x31008018, 0x3100c008, 0x3100c008, 0x3100c018, 0x3100c018,
+	0x13000009, 0x13000019, 0x13004009, 0x13004019, 0x13008009, 0x13008019, 0x1300c009, 0x1300c019,
+	0x03000008, 0x03000008, 0x03000018, 0x03000018, 0x03004008, 0x03004008, 0x03004018, 0x03004018,
+	0x30000008, 0x30000008, 0x30000018, 0x30000018, 0x30008008, 0x30008008, 0x30008018, 0x30008018,
+	0x22000009, 0x22000019, 0x22004009, 0x22004019, 0x22008009, 0x22008019, 0x2200c009, 0x2200c019,
+	0x12000008, 0x12000008, 0x12000018, 0x12000018, 0x12004008, 0x12004008, 0x12004018, 0x12004018,
+	0x12008008, 0x12008008, 0x12008018, 0x12008018, 0x1200c008, 0x1200c008, 0x1200c018, 0x1200c018,
+	0x21000008, 0x21000008, 0x21000018, 0x21000018, 0x21004008, 0x21004008, 0x21004018, 0x21004018,
+	0x21008008, 0x21008008, 0x21008018, 0x21008018, 0x2100c008, 0x2100c008, 0x2100c018, 0x2100c018,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000017, 0x02000017, 0x02000017, 0x02000017,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004017, 0x02004017, 0x02004017, 0x02004017,
+	0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000017, 0x20000017, 0x20000017, 0x20000017,
+	0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008017, 0x20008017, 0x20008017, 0x20008017,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11110055, 0x11111055, 0x11112055, 0x11113055,
+	0x11010045, 0x11010045, 0x11011045, 0x11011045, 0x11100045, 0x11100045, 0x11102045, 0x11102045,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11114055, 0x11115055, 0x11116055, 0x11117055,
+	0x11014045, 0x11014045, 0x11015045, 0x11015045, 0x11104045, 0x11104045, 0x11106045, 0x11106045,
+	0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015,
+	0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015, 0x11004015,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11118055, 0x11119055, 0x1111a055, 0x1111b055,
+	0x11018045, 0x11018045, 0x11019045, 0x11019045, 0x11108045, 0x11108045, 0x1110a045, 0x1110a045,
+	0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015,
+	0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015, 0x11008015,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1111c055, 0x1111d055, 0x1111e055, 0x1111f055,
+	0x1101c045, 0x1101c045, 0x1101d045, 0x1101d045, 0x1110c045, 0x1110c045, 0x1110e045, 0x1110e045,
+	0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015,
+	0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015, 0x1100c015,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01110054, 0x01110054, 0x01111054, 0x01111054, 0x01112054, 0x01112054, 0x01113054, 0x01113054,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01114054, 0x01114054, 0x01115054, 0x01115054, 0x01116054, 0x01116054, 0x01117054, 0x01117054,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10110054, 0x10110054, 0x10111054, 0x10111054, 0x10112054, 0x10112054, 0x10113054, 0x10113054,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10118054, 0x10118054, 0x10119054, 0x10119054, 0x1011a054, 0x1011a054, 0x1011b054, 0x1011b054,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00320091, 0x00321091, 0x00322091, 0x00323091,
+	0x00310081, 0x00310081, 0x00311081, 0x00311081, 0x00312081, 0x00312081, 0x00313081, 0x00313081,
+	0x00130091, 0x00131091, 0x00132091, 0x00133091, 0x00030081, 0x00030081, 0x00031081, 0x00031081,
+	0x00300081, 0x00300081, 0x00302081, 0x00302081, 0x00220091, 0x00221091, 0x00222091, 0x00223091,
+	0x00120081, 0x00120081, 0x00121081, 0x00121081, 0x00122081, 0x00122081, 0x00123081, 0x00123081,
+	0x00210081, 0x00210081, 0x00211081, 0x00211081, 0x00212081, 0x00212081, 0x00213081, 0x00213081,
+	0x00020071, 0x00020071, 0x00020071, 0x00020071, 0x00021071, 0x00021071, 0x00021071, 0x00021071,
+	0x00200071, 0x00200071, 0x00200071, 0x00200071, 0x00202071, 0x00202071, 0x00202071, 0x00202071,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051,
+	0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051, 0x00111051,
+	0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051,
+	0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051, 0x00112051,
+	0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051,
+	0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051, 0x00113051,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* huffWideTable06[1024] */
+	0x33000009, 0x33000009, 0x33004009, 0x33004009, 0x33008009, 0x33008009, 0x3300c009, 0x3300c009,
+	0x03000008, 0x03000008, 0x03000008, 0x03000008, 0x03004008, 0x03004008, 0x03004008, 0x03004008,
+	0x23000008, 0x23000008, 0x23000008, 0x23000008, 0x23004008, 0x23004008, 0x23004008, 0x23004008,
+	0x23008008, 0x23008008, 0x23008008, 0x23008008, 0x2300c008, 0x2300c008, 0x2300c008, 0x2300c008,
+	0x32000008, 0x32000008, 0x32000008, 0x32000008, 0x32004008, 0x32004008, 0x32004008, 0x32004008,
+	0x32008008, 0x32008008, 0x32008008, 0x32008008, 0x3200c008, 0x3200c008, 0x3200c008, 0x3200c008,
+	0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000037,
+	0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008037,
+	0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000037,
+	0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004037,
+	0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008037,
+	0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c037,
+	0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000037,
+	0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004037,
+	0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008037,
+	0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c037,
+	0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000037,
+	0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004037,
+	0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008037,
+	0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c037,
+	0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02010046, 0x02011046,
+	0x02110046, 0x02111046, 0x02112046, 0x02113046, 0x02100046, 0x02102046, 0x02000036, 0x02000036,
+	0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02014046, 0x02015046,
+	0x02114046, 0x02115046, 0x02116046, 0x02117046, 0x02104046, 0x02106046, 0x02004036, 0x02004036,
+	0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12010046, 0x12011046,
+	0x12110046, 0x12111046, 0x12112046, 0x12113046, 0x12100046, 0x12102046, 0x12000036, 0x12000036,
+	0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12014046, 0x12015046,
+	0x12114046, 0x12115046, 0x12116046, 0x12117046, 0x12104046, 0x12106046, 0x12004036, 0x12004036,
+	0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12018046, 0x12019046,
+	0x12118046, 0x12119046, 0x1211a046, 0x1211b046, 0x12108046, 0x1210a046, 0x12008036, 0x12008036,
+	0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1201c046, 0x1201d046,
+	0x1211c046, 0x1211d046, 0x1211e046, 0x1211f046, 0x1210c046, 0x1210e046, 0x1200c036, 0x1200c036,
+	0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21010046, 0x21011046,
+	0x21110046, 0x21111046, 0x21112046, 0x21113046, 0x21100046, 0x21102046, 0x21000036, 0x21000036,
+	0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21014046, 0x21015046,
+	0x21114046, 0x21115046, 0x21116046, 0x21117046, 0x21104046, 0x21106046, 0x21004036, 0x21004036,
+	0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21018046, 0x21019046,
+	0x21118046, 0x21119046, 0x2111a046, 0x2111b046, 0x21108046, 0x2110a046, 0x21008036, 0x21008036,
+	0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2101c046, 0x2101d046,
+	0x2111c046, 0x2111d046, 0x2111e046, 0x2111f046, 0x2110c046, 0x2110e046, 0x2100c036, 0x2100c036,
+	0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005,
+	0x20000005, 0x20000005, 0x20200055, 0x20202055, 0x20010045, 0x20010045, 0x20011045, 0x20011045,
+	0x20110045, 0x20110045, 0x20111045, 0x20111045, 0x20112045, 0x20112045, 0x20113045, 0x20113045,
+	0x20100045, 0x20100045, 0x20102045, 0x20102045, 0x20000035, 0x20000035, 0x20000035, 0x20000035,
+	0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005,
+	0x20008005, 0x20008005, 0x20208055, 0x2020a055, 0x20018045, 0x20018045, 0x20019045, 0x20019045,
+	0x20118045, 0x20118045, 0x20119045, 0x20119045, 0x2011a045, 0x2011a045, 0x2011b045, 0x2011b045,
+	0x20108045, 0x20108045, 0x2010a045, 0x2010a045, 0x20008035, 0x20008035, 0x20008035, 0x20008035,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01020064, 0x01021064, 0x01120064, 0x01121064, 0x01122064, 0x01123064,
+	0x01210064, 0x01211064, 0x01212064, 0x01213064, 0x01200054, 0x01200054, 0x01202054, 0x01202054,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01110044, 0x01110044, 0x01110044, 0x01110044, 0x01111044, 0x01111044, 0x01111044, 0x01111044,
+	0x01112044, 0x01112044, 0x01112044, 0x01112044, 0x01113044, 0x01113044, 0x01113044, 0x01113044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01024064, 0x01025064, 0x01124064, 0x01125064, 0x01126064, 0x01127064,
+	0x01214064, 0x01215064, 0x01216064, 0x01217064, 0x01204054, 0x01204054, 0x01206054, 0x01206054,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01114044, 0x01114044, 0x01114044, 0x01114044, 0x01115044, 0x01115044, 0x01115044, 0x01115044,
+	0x01116044, 0x01116044, 0x01116044, 0x01116044, 0x01117044, 0x01117044, 0x01117044, 0x01117044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034,
+	0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004,
+	0x11000004, 0x11000004, 0x11020064, 0x11021064, 0x11120064, 0x11121064, 0x11122064, 0x11123064,
+	0x11210064, 0x11211064, 0x11212064, 0x11213064, 0x11200054, 0x11200054, 0x11202054, 0x11202054,
+	0x11010044, 0x11010044, 0x11010044, 0x11010044, 0x11011044, 0x11011044, 0x11011044, 0x11011044,
+	0x11110044, 0x11110044, 0x11110044, 0x11110044, 0x11111044, 0x11111044, 0x11111044, 0x11111044,
+	0x11112044, 0x11112044, 0x11112044, 0x11112044, 0x11113044, 0x11113044, 0x11113044, 0x11113044,
+	0x11100044, 0x11100044, 0x11100044, 0x11100044, 0x11102044, 0x11102044, 0x11102044, 0x11102044,
+	0x11000034, 0x11000034, 0x11000034, 0x11000034, 0x11000034, 0x11000034, 0x11000034, 0x11000034,
+	0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004,
+	0x11004004, 0x11004004, 0x11024064, 0x11025064, 0x11124064, 0x11125064, 0x11126064, 0x11127064,
+	0x11214064, 0x11215064, 0x11216064, 0x11217064, 0x11204054, 0x11204054, 0x11206054, 0x11206054,
+	0x11014044, 0x11014044, 0x11014044, 0x11014044, 0x11015044, 0x11015044, 0x11015044, 0x11015044,
+	0x11114044, 0x11114044, 0x11114044, 0x11114044, 0x11115044, 0x11115044, 0x11115044, 0x11115044,
+	0x11116044, 0x11116044, 0x11116044, 0x11116044, 0x11117044, 0x11117044, 0x11117044, 0x11117044,
+	0x11104044, 0x11104044, 0x11104044, 0x11104044, 0x11106044, 0x11106044, 0x11106044, 0x11106044,
+	0x11004034, 0x11004034, 0x11004034, 0x11004034, 0x11004034, 0x11004034, 0x11004034, 0x11004034,
+	0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004,
+	0x11008004, 0x11008004, 0x11028064, 0x11029064, 0x11128064, 0x11129064, 0x1112a064, 0x1112b064,
+	0x11218064, 0x11219064, 0x1121a064, 0x1121b064, 0x11208054, 0x11208054, 0x1120a054, 0x1120a054,
+	0x11018044, 0x11018044, 0x11018044, 0x11018044, 0x11019044, 0x11019044, 0x11019044, 0x11019044,
+	0x11118044, 0x11118044, 0x11118044, 0x11118044, 0x11119044, 0x11119044, 0x11119044, 0x11119044,
+	0x1111a044, 0x1111a044, 0x1111a044, 0x1111a044, 0x1111b044, 0x1111b044, 0x1111b044, 0x1111b044,
+	0x11108044, 0x11108044, 0x11108044, 0x11108044, 0x1110a044, 0x1110a044, 0x1110a044, 0x1110a044,
+	0x11008034, 0x11008034, 0x11008034, 0x11008034, 0x11008034, 0x11008034, 0x11008034, 0x11008034,
+	0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004,
+	0x1100c004, 0x1100c004, 0x1102c064, 0x1102d064, 0x1112c064, 0x1112d064, 0x1112e064, 0x1112f064,
+	0x1121c064, 0x1121d064, 0x1121e064, 0x1121f064, 0x1120c054, 0x1120c054, 0x1120e054, 0x1120e054,
+	0x1101c044, 0x1101c044, 0x1101c044, 0x1101c044, 0x1101d044, 0x1101d044, 0x1101d044, 0x1101d044,
+	0x1111c044, 0x1111c044, 0x1111c044, 0x1111c044, 0x1111d044, 0x1111d044, 0x1111d044, 0x1111d044,
+	0x1111e044, 0x1111e044, 0x1111e044, 0x1111e044, 0x1111f044, 0x1111f044, 0x1111f044, 0x1111f044,
+	0x1110c044, 0x1110c044, 0x1110c044, 0x1110c044, 0x1110e044, 0x1110e044, 0x1110e044, 0x1110e044,
+	0x1100c034, 0x1100c034, 0x1100c034, 0x1100c034, 0x1100c034, 0x1100c034, 0x1100c034, 0x1100c034,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10020064, 0x10021064, 0x10120064, 0x10121064, 0x10122064, 0x10123064,
+	0x10210064, 0x10211064, 0x10212064, 0x10213064, 0x10200054, 0x10200054, 0x10202054, 0x10202054,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10110044, 0x10110044, 0x10110044, 0x10110044, 0x10111044, 0x10111044, 0x10111044, 0x10111044,
+	0x10112044, 0x10112044, 0x10112044, 0x10112044, 0x10113044, 0x10113044, 0x10113044, 0x10113044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10028064, 0x10029064, 0x10128064, 0x10129064, 0x1012a064, 0x1012b064,
+	0x10218064, 0x10219064, 0x1021a064, 0x1021b064, 0x10208054, 0x10208054, 0x1020a054, 0x1020a054,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10118044, 0x10118044, 0x10118044, 0x10118044, 0x10119044, 0x10119044, 0x10119044, 0x10119044,
+	0x1011a044, 0x1011a044, 0x1011a044, 0x1011a044, 0x1011b044, 0x1011b044, 0x1011b044, 0x1011b044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00300073, 0x00302073,
+	0x00130073, 0x00131073, 0x00132073, 0x00133073, 0x00310073, 0x00311073, 0x00312073, 0x00313073,
+	0x00220073, 0x00221073, 0x00222073, 0x00223073, 0x00020063, 0x00020063, 0x00021063, 0x00021063,
+	0x00120063, 0x00120063, 0x00121063, 0x00121063, 0x00122063, 0x00122063, 0x00123063, 0x00123063,
+	0x00210063, 0x00210063, 0x00211063, 0x00211063, 0x00212063, 0x00212063, 0x00213063, 0x00213063,
+	0x00200053, 0x00200053, 0x00200053, 0x00200053, 0x00202053, 0x00202053, 0x00202053, 0x00202053,
+	0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043,
+	0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043,
+	0x00110043, 0x00110043, 0x00110043, 0x00110043, 0x00110043, 0x00110043, 0x00110043, 0x00110043,
+	0x00111043, 0x00111043, 0x00111043, 0x00111043, 0x00111043, 0x00111043, 0x00111043, 0x00111043,
+	0x00112043, 0x00112043, 0x00112043, 0x00112043, 0x00112043, 0x00112043, 0x00112043, 0x00112043,
+	0x00113043, 0x00113043, 0x00113043, 0x00113043, 0x00113043, 0x00113043, 0x00113043, 0x00113043,
+	0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043,
+	0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043,
+	0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+	0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+	/* huffWideTable07[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1500000a, 0x1500400a, 0x1500800a, 0x1500c00a,
+	0x5100000a, 0x5100400a, 0x5100800a, 0x5100c00a, 0x0500000a, 0x0500400a, 0x00000000, 0x00000000,
+	0x50000009, 0x50000019, 0x50008009, 0x50008019, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2400000a, 0x2400400a, 0x2400800a, 0x2400c00a, 0x4200000a, 0x4200400a, 0x4200800a, 0x4200c00a,
+	0x14000009, 0x14000019, 0x14004009, 0x14004019, 0x14008009, 0x14008019, 0x1400c009, 0x1400c019,
+	0x41000009, 0x41000019, 0x41004009, 0x41004019, 0x41008009, 0x41008019, 0x4100c009, 0x4100c019,
+	0x40000008, 0x40000008, 0x40000018, 0x40000018, 0x40008008, 0x40008008, 0x40008018, 0x40008018,
+	0x04000009, 0x04000019, 0x04004009, 0x04004019, 0x2300000a, 0x2300400a, 0x2300800a, 0x2300c00a,
+	0x3200000a, 0x3200400a, 0x3200800a, 0x3200c00a, 0x03000009, 0x03000019, 0x03004009, 0x03004019,
+	0x13000009, 0x13000019, 0x13004009, 0x13004019, 0x13008009, 0x13008019, 0x1300c009, 0x1300c019,
+	0x31000009, 0x31000019, 0x31004009, 0x31004019, 0x31008009, 0x31008019, 0x3100c009, 0x3100c019,
+	0x30000008, 0x30000008, 0x30000018, 0x30000018, 0x30008008, 0x30008008, 0x30008018, 0x30008018,
+	0x22000009, 0x22000019, 0x22004009, 0x22004019, 0x22008009, 0x22008019, 0x2200c009, 0x2200c019,
+	0x12000008, 0x12000008, 0x12000018, 0x12000018, 0x12004008, 0x12004008, 0x12004018, 0x12004018,
+	0x12008008, 0x12008008, 0x12008018, 0x12008018, 0x1200c008, 0x1200c008, 0x1200c018, 0x1200c018,
+	0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000017, 0x21000017, 0x21000017, 0x21000017,
+	0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004017, 0x21004017, 0x21004017, 0x21004017,
+	0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008017, 0x21008017, 0x21008017, 0x21008017,
+	0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c017, 0x2100c017, 0x2100c017, 0x2100c017,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000017, 0x02000017, 0x02000017, 0x02000017,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004017, 0x02004017, 0x02004017, 0x02004017,
+	0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000017, 0x20000017, 0x20000017, 0x20000017,
+	0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008017, 0x20008017, 0x20008017, 0x20008017,
+	0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11010046, 0x11011046, 0x11100046, 0x11102046,
+	0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016,
+	0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11014046, 0x11015046, 0x11104046, 0x11106046,
+	0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016,
+	0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11018046, 0x11019046, 0x11108046, 0x1110a046,
+	0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016,
+	0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1101c046, 0x1101d046, 0x1110c046, 0x1110e046,
+	0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01110064, 0x01111064, 0x01112064, 0x01113064,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01114064, 0x01115064, 0x01116064, 0x01117064,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10110064, 0x10111064, 0x10112064, 0x10113064,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10118064, 0x10119064, 0x1011a064, 0x1011b064,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00500091, 0x00502091, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00140091, 0x00141091, 0x00142091, 0x00143091,
+	0x00410091, 0x00411091, 0x00412091, 0x00413091, 0x00400081, 0x00400081, 0x00402081, 0x00402081,
+	0x00040091, 0x00041091, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00030091, 0x00031091,
+	0x00130091, 0x00131091, 0x00132091, 0x00133091, 0x00310091, 0x00311091, 0x00312091, 0x00313091,
+	0x00300081, 0x00300081, 0x00302081, 0x00302081, 0x00220091, 0x00221091, 0x00222091, 0x00223091,
+	0x00120081, 0x00120081, 0x00121081, 0x00121081, 0x00122081, 0x00122081, 0x00123081, 0x00123081,
+	0x00210071, 0x00210071, 0x00210071, 0x00210071, 0x00211071, 0x00211071, 0x00211071, 0x00211071,
+	0x00212071, 0x00212071, 0x00212071, 0x00212071, 0x00213071, 0x00213071, 0x00213071, 0x00213071,
+	0x00020071, 0x00020071, 0x00020071, 0x00020071, 0x00021071, 0x00021071, 0x00021071, 0x00021071,
+	0x00200071, 0x00200071, 0x00200071, 0x00200071, 0x00202071, 0x00202071, 0x00202071, 0x00202071,
+	0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061,
+	0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061,
+	0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061,
+	0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* huffWideTable08[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0500000a, 0x0500400a, 0x1500000a, 0x1500400a, 0x1500800a, 0x1500c00a,
+	0x5100000a, 0x5100400a, 0x5100800a, 0x5100c00a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x5000000a, 0x5000800a, 0x00000000, 0x00000000, 0x2400000a, 0x2400400a, 0x2400800a, 0x2400c00a,
+	0x4200000a, 0x4200400a, 0x4200800a, 0x4200c00a, 0x1400000a, 0x1400400a, 0x1400800a, 0x1400c00a,
+	0x41000009, 0x41000009, 0x41004009, 0x41004009, 0x41008009, 0x41008009, 0x4100c009, 0x4100c009,
+	0x04000009, 0x04000009, 0x04004009, 0x04004009, 0x40000009, 0x40000009, 0x40008009, 0x40008009,
+	0x2300000a, 0x2300400a, 0x2300800a, 0x2300c00a, 0x3200000a, 0x3200400a, 0x3200800a, 0x3200c00a,
+	0x1300000a, 0x1300400a, 0x1300800a, 0x1300c00a, 0x3100000a, 0x3100400a, 0x3100800a, 0x3100c00a,
+	0x03000009, 0x03000009, 0x03004009, 0x03004009, 0x30000009, 0x30000009, 0x30008009, 0x30008009,
+	0x22000008, 0x22000008, 0x22000008, 0x22000028, 0x22004008, 0x22004008, 0x22004008, 0x22004028,
+	0x22008008, 0x22008008, 0x22008008, 0x22008028, 0x2200c008, 0x2200c008, 0x2200c008, 0x2200c028,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000027, 0x02000027,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004027, 0x02004027,
+	0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000027, 0x20000027,
+	0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008027, 0x20008027,
+	0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12110046, 0x12111046, 0x12112046, 0x12113046,
+	0x12010046, 0x12011046, 0x12100046, 0x12102046, 0x12000026, 0x12000026, 0x12000026, 0x12000026,
+	0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12114046, 0x12115046, 0x12116046, 0x12117046,
+	0x12014046, 0x12015046, 0x12104046, 0x12106046, 0x12004026, 0x12004026, 0x12004026, 0x12004026,
+	0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12118046, 0x12119046, 0x1211a046, 0x1211b046,
+	0x12018046, 0x12019046, 0x12108046, 0x1210a046, 0x12008026, 0x12008026, 0x12008026, 0x12008026,
+	0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1211c046, 0x1211d046, 0x1211e046, 0x1211f046,
+	0x1201c046, 0x1201d046, 0x1210c046, 0x1210e046, 0x1200c026, 0x1200c026, 0x1200c026, 0x1200c026,
+	0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21110046, 0x21111046, 0x21112046, 0x21113046,
+	0x21010046, 0x21011046, 0x21100046, 0x21102046, 0x21000026, 0x21000026, 0x21000026, 0x21000026,
+	0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21114046, 0x21115046, 0x21116046, 0x21117046,
+	0x21014046, 0x21015046, 0x21104046, 0x21106046, 0x21004026, 0x21004026, 0x21004026, 0x21004026,
+	0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21118046, 0x21119046, 0x2111a046, 0x2111b046,
+	0x21018046, 0x21019046, 0x21108046, 0x2110a046, 0x21008026, 0x21008026, 0x21008026, 0x21008026,
+	0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2111c046, 0x2111d046, 0x2111e046, 0x2111f046,
+	0x2101c046, 0x2101d046, 0x2110c046, 0x2110e046, 0x2100c026, 0x2100c026, 0x2100c026, 0x2100c026,
+	0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004, 0x11000004,
+	0x11120064, 0x11121064, 0x11122064, 0x11123064, 0x11210064, 0x11211064, 0x11212064, 0x11213064,
+	0x11110044, 0x11110044, 0x11110044, 0x11110044, 0x11111044, 0x11111044, 0x11111044, 0x11111044,
+	0x11112044, 0x11112044, 0x11112044, 0x11112044, 0x11113044, 0x11113044, 0x11113044, 0x11113044,
+	0x11010044, 0x11010044, 0x11010044, 0x11010044, 0x11011044, 0x11011044, 0x11011044, 0x11011044,
+	0x11100044, 0x11100044, 0x11100044, 0x11100044, 0x11102044, 0x11102044, 0x11102044, 0x11102044,
+	0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024,
+	0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024, 0x11000024,
+	0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004, 0x11004004,
+	0x11124064, 0x11125064, 0x11126064, 0x11127064, 0x11214064, 0x11215064, 0x11216064, 0x11217064,
+	0x11114044, 0x11114044, 0x11114044, 0x11114044, 0x11115044, 0x11115044, 0x11115044, 0x11115044,
+	0x11116044, 0x11116044, 0x11116044, 0x11116044, 0x11117044, 0x11117044, 0x11117044, 0x11117044,
+	0x11014044, 0x11014044, 0x11014044, 0x11014044, 0x11015044, 0x11015044, 0x11015044, 0x11015044,
+	0x11104044, 0x11104044, 0x11104044, 0x11104044, 0x11106044, 0x11106044, 0x11106044, 0x11106044,
+	0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024,
+	0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024, 0x11004024,
+	0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004, 0x11008004,
+	0x11128064, 0x11129064, 0x1112a064, 0x1112b064, 0x11218064, 0x11219064, 0x1121a064, 0x1121b064,
+	0x11118044, 0x11118044, 0x11118044, 0x11118044, 0x11119044, 0x11119044, 0x11119044, 0x11119044,
+	0x1111a044, 0x1111a044, 0x1111a044, 0x1111a044, 0x1111b044, 0x1111b044, 0x1111b044, 0x1111b044,
+	0x11018044, 0x11018044, 0x11018044, 0x11018044, 0x11019044, 0x11019044, 0x11019044, 0x11019044,
+	0x11108044, 0x11108044, 0x11108044, 0x11108044, 0x1110a044, 0x1110a044, 0x1110a044, 0x1110a044,
+	0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024,
+	0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024, 0x11008024,
+	0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004, 0x1100c004,
+	0x1112c064, 0x1112d064, 0x1112e064, 0x1112f064, 0x1121c064, 0x1121d064, 0x1121e064, 0x1121f064,
+	0x1111c044, 0x1111c044, 0x1111c044, 0x1111c044, 0x1111d044, 0x1111d044, 0x1111d044, 0x1111d044,
+	0x1111e044, 0x1111e044, 0x1111e044, 0x1111e044, 0x1111f044, 0x1111f044, 0x1111f044, 0x1111f044,
+	0x1101c044, 0x1101c044, 0x1101c044, 0x1101c044, 0x1101d044, 0x1101d044, 0x1101d044, 0x1101d044,
+	0x1110c044, 0x1110c044, 0x1110c044, 0x1110c044, 0x1110e044, 0x1110e044, 0x1110e044, 0x1110e044,
+	0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024,
+	0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024, 0x1100c024,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01120064, 0x01121064, 0x01122064, 0x01123064, 0x01210064, 0x01211064, 0x01212064, 0x01213064,
+	0x01110044, 0x01110044, 0x01110044, 0x01110044, 0x01111044, 0x01111044, 0x01111044, 0x01111044,
+	0x01112044, 0x01112044, 0x01112044, 0x01112044, 0x01113044, 0x01113044, 0x01113044, 0x01113044,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024,
+	0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01124064, 0x01125064, 0x01126064, 0x01127064, 0x01214064, 0x01215064, 0x01216064, 0x01217064,
+	0x01114044, 0x01114044, 0x01114044, 0x01114044, 0x01115044, 0x01115044, 0x01115044, 0x01115044,
+	0x01116044, 0x01116044, 0x01116044, 0x01116044, 0x01117044, 0x01117044, 0x01117044, 0x01117044,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024,
+	0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10120064, 0x10121064, 0x10122064, 0x10123064, 0x10210064, 0x10211064, 0x10212064, 0x10213064,
+	0x10110044, 0x10110044, 0x10110044, 0x10110044, 0x10111044, 0x10111044, 0x10111044, 0x10111044,
+	0x10112044, 0x10112044, 0x10112044, 0x10112044, 0x10113044, 0x10113044, 0x10113044, 0x10113044,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024,
+	0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10128064, 0x10129064, 0x1012a064, 0x1012b064, 0x10218064, 0x10219064, 0x1021a064, 0x1021b064,
+	0x10118044, 0x10118044, 0x10118044, 0x10118044, 0x10119044, 0x10119044, 0x10119044, 0x10119044,
+	0x1011a044, 0x1011a044, 0x1011a044, 0x1011a044, 0x1011b044, 0x1011b044, 0x1011b044, 0x1011b044,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024,
+	0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00220082, 0x00221082, 0x00222082, 0x00223082,
+	0x00020072, 0x00020072, 0x00021072, 0x00021072, 0x00200072, 0x00200072, 0x00202072, 0x00202072,
+	0x00120062, 0x00120062, 0x00120062, 0x00120062, 0x00121062, 0x00121062, 0x00121062, 0x00121062,
+	0x00122062, 0x00122062, 0x00122062, 0x00122062, 0x00123062, 0x00123062, 0x00123062, 0x00123062,
+	0x00210062, 0x00210062, 0x00210062, 0x00210062, 0x00211062, 0x00211062, 0x00211062, 0x00211062,
+	0x00212062, 0x00212062, 0x00212062, 0x00212062, 0x00213062, 0x00213062, 0x00213062, 0x00213062,
+	0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042,
+	0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042, 0x00110042,
+	0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042,
+	0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042, 0x00111042,
+	0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042,
+	0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042, 0x00112042,
+	0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042,
+	0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042, 0x00113042,
+	0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042,
+	0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042,
+	0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042,
+	0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042,
+	0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042,
+	0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042,
+	0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042,
+	0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	/* huffWideTable09[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3500000a, 0x3500400a, 0x3500800a, 0x3500c00a,
+	0x5300000a, 0x5300400a, 0x5300800a, 0x5300c00a, 0x00000000, 0x00000000, 0x0500000a, 0x0500400a,
+	0x4400000a, 0x4400400a, 0x4400800a, 0x4400c00a, 0x2500000a, 0x2500400a, 0x2500800a, 0x2500c00a,
+	0x5200000a, 0x5200400a, 0x5200800a, 0x5200c00a, 0x1500000a, 0x1500400a, 0x1500800a, 0x1500c00a,
+	0x51000009, 0x51000009, 0x51004009, 0x51004009, 0x51008009, 0x51008009, 0x5100c009, 0x5100c009,
+	0x34000009, 0x34000009, 0x34004009, 0x34004009, 0x34008009, 0x34008009, 0x3400c009, 0x3400c009,
+	0x43000009, 0x43000009, 0x43004009, 0x43004009, 0x43008009, 0x43008009, 0x4300c009, 0x4300c009,
+	0x50000009, 0x50000009, 0x50008009, 0x50008009, 0x04000009, 0x04000009, 0x04004009, 0x04004009,
+	0x24000009, 0x24000009, 0x24004009, 0x24004009, 0x24008009, 0x24008009, 0x2400c009, 0x2400c009,
+	0x42000009, 0x42000009, 0x42004009, 0x42004009, 0x42008009, 0x42008009, 0x4200c009, 0x4200c009,
+	0x33000009, 0x33000009, 0x33004009, 0x33004009, 0x33008009, 0x33008009, 0x3300c009, 0x3300c009,
+	0x40000008, 0x40000008, 0x40000008, 0x40000008, 0x40008008, 0x40008008, 0x40008008, 0x40008008,
+	0x14000008, 0x14000008, 0x14000008, 0x14000008, 0x14004008, 0x14004008, 0x14004008, 0x14004008,
+	0x14008008, 0x14008008, 0x14008008, 0x14008008, 0x1400c008, 0x1400c008, 0x1400c008, 0x1400c008,
+	0x41000008, 0x41000008, 0x41000008, 0x41000008, 0x41004008, 0x41004008, 0x41004008, 0x41004008,
+	0x41008008, 0x41008008, 0x41008008, 0x41008008, 0x4100c008, 0x4100c008, 0x4100c008, 0x4100c008,
+	0x23000008, 0x23000008, 0x23000008, 0x23000008, 0x23004008, 0x23004008, 0x23004008, 0x23004008,
+	0x23008008, 0x23008008, 0x23008008, 0x23008008, 0x2300c008, 0x2300c008, 0x2300c008, 0x2300c008,
+	0x32000008, 0x32000008, 0x32000008, 0x32000008, 0x32004008, 0x32004008, 0x32004008, 0x32004008,
+	0x32008008, 0x32008008, 0x32008008, 0x32008008, 0x3200c008, 0x3200c008, 0x3200c008, 0x3200c008,
+	0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000037,
+	0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004037,
+	0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008037,
+	0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c037,
+	0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000037,
+	0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004037,
+	0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008037,
+	0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c037,
+	0x03000007, 0x03000007, 0x03000007, 0x03000007, 0x03000007, 0x03000007, 0x03000007, 0x03000037,
+	0x03004007, 0x03004007, 0x03004007, 0x03004007, 0x03004007, 0x03004007, 0x03004007, 0x03004037,
+	0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000037,
+	0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008037,
+	0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000037,
+	0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004037,
+	0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008037,
+	0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c037,
+	0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006,
+	0x02000006, 0x02000006, 0x02010046, 0x02011046, 0x02100046, 0x02102046, 0x02000036, 0x02000036,
+	0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006,
+	0x02004006, 0x02004006, 0x02014046, 0x02015046, 0x02104046, 0x02106046, 0x02004036, 0x02004036,
+	0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006,
+	0x12000006, 0x12000006, 0x12010046, 0x12011046, 0x12100046, 0x12102046, 0x12000036, 0x12000036,
+	0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006,
+	0x12004006, 0x12004006, 0x12014046, 0x12015046, 0x12104046, 0x12106046, 0x12004036, 0x12004036,
+	0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006,
+	0x12008006, 0x12008006, 0x12018046, 0x12019046, 0x12108046, 0x1210a046, 0x12008036, 0x12008036,
+	0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006,
+	0x1200c006, 0x1200c006, 0x1201c046, 0x1201d046, 0x1210c046, 0x1210e046, 0x1200c036, 0x1200c036,
+	0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006,
+	0x21000006, 0x21000006, 0x21010046, 0x21011046, 0x21100046, 0x21102046, 0x21000036, 0x21000036,
+	0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006,
+	0x21004006, 0x21004006, 0x21014046, 0x21015046, 0x21104046, 0x21106046, 0x21004036, 0x21004036,
+	0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006,
+	0x21008006, 0x21008006, 0x21018046, 0x21019046, 0x21108046, 0x2110a046, 0x21008036, 0x21008036,
+	0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006,
+	0x2100c006, 0x2100c006, 0x2101c046, 0x2101d046, 0x2110c046, 0x2110e046, 0x2100c036, 0x2100c036,
+	0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005,
+	0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20200055, 0x20202055,
+	0x20110055, 0x20111055, 0x20112055, 0x20113055, 0x20010045, 0x20010045, 0x20011045, 0x20011045,
+	0x20100045, 0x20100045, 0x20102045, 0x20102045, 0x20000035, 0x20000035, 0x20000035, 0x20000035,
+	0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005,
+	0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20008005, 0x20208055, 0x2020a055,
+	0x20118055, 0x20119055, 0x2011a055, 0x2011b055, 0x20018045, 0x20018045, 0x20019045, 0x20019045,
+	0x20108045, 0x20108045, 0x2010a045, 0x2010a045, 0x20008035, 0x20008035, 0x20008035, 0x20008035,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11200055, 0x11202055,
+	0x11110055, 0x11111055, 0x11112055, 0x11113055, 0x11010045, 0x11010045, 0x11011045, 0x11011045,
+	0x11100045, 0x11100045, 0x11102045, 0x11102045, 0x11000035, 0x11000035, 0x11000035, 0x11000035,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11204055, 0x11206055,
+	0x11114055, 0x11115055, 0x11116055, 0x11117055, 0x11014045, 0x11014045, 0x11015045, 0x11015045,
+	0x11104045, 0x11104045, 0x11106045, 0x11106045, 0x11004035, 0x11004035, 0x11004035, 0x11004035,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11208055, 0x1120a055,
+	0x11118055, 0x11119055, 0x1111a055, 0x1111b055, 0x11018045, 0x11018045, 0x11019045, 0x11019045,
+	0x11108045, 0x11108045, 0x1110a045, 0x1110a045, 0x11008035, 0x11008035, 0x11008035, 0x11008035,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1120c055, 0x1120e055,
+	0x1111c055, 0x1111d055, 0x1111e055, 0x1111f055, 0x1101c045, 0x1101c045, 0x1101d045, 0x1101d045,
+	0x1110c045, 0x1110c045, 0x1110e045, 0x1110e045, 0x1100c035, 0x1100c035, 0x1100c035, 0x1100c035,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01020064, 0x01021064, 0x01120064, 0x01121064, 0x01122064, 0x01123064,
+	0x01210064, 0x01211064, 0x01212064, 0x01213064, 0x01200054, 0x01200054, 0x01202054, 0x01202054,
+	0x01110054, 0x01110054, 0x01111054, 0x01111054, 0x01112054, 0x01112054, 0x01113054, 0x01113054,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034, 0x01000034,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01024064, 0x01025064, 0x01124064, 0x01125064, 0x01126064, 0x01127064,
+	0x01214064, 0x01215064, 0x01216064, 0x01217064, 0x01204054, 0x01204054, 0x01206054, 0x01206054,
+	0x01114054, 0x01114054, 0x01115054, 0x01115054, 0x01116054, 0x01116054, 0x01117054, 0x01117054,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034, 0x01004034,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10020064, 0x10021064, 0x10120064, 0x10121064, 0x10122064, 0x10123064,
+	0x10210064, 0x10211064, 0x10212064, 0x10213064, 0x10200054, 0x10200054, 0x10202054, 0x10202054,
+	0x10110054, 0x10110054, 0x10111054, 0x10111054, 0x10112054, 0x10112054, 0x10113054, 0x10113054,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034, 0x10000034,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10028064, 0x10029064, 0x10128064, 0x10129064, 0x1012a064, 0x1012b064,
+	0x10218064, 0x10219064, 0x1021a064, 0x1021b064, 0x10208054, 0x10208054, 0x1020a054, 0x1020a054,
+	0x10118054, 0x10118054, 0x10119054, 0x10119054, 0x1011a054, 0x1011a054, 0x1011b054, 0x1011b054,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034, 0x10008034,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00130073, 0x00131073, 0x00132073, 0x00133073,
+	0x00310073, 0x00311073, 0x00312073, 0x00313073, 0x00030073, 0x00031073, 0x00300073, 0x00302073,
+	0x00220073, 0x00221073, 0x00222073, 0x00223073, 0x00020063, 0x00020063, 0x00021063, 0x00021063,
+	0x00120063, 0x00120063, 0x00121063, 0x00121063, 0x00122063, 0x00122063, 0x00123063, 0x00123063,
+	0x00210063, 0x00210063, 0x00211063, 0x00211063, 0x00212063, 0x00212063, 0x00213063, 0x00213063,
+	0x00200053, 0x00200053, 0x00200053, 0x00200053, 0x00202053, 0x00202053, 0x00202053, 0x00202053,
+	0x00110053, 0x00110053, 0x00110053, 0x00110053, 0x00111053, 0x00111053, 0x00111053, 0x00111053,
+	0x00112053, 0x00112053, 0x00112053, 0x00112053, 0x00113053, 0x00113053, 0x00113053, 0x00113053,
+	0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043, 0x00010043,
+	0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043, 0x00011043,
+	0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043, 0x00100043,
+	0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043, 0x00102043,
+	0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+	0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+	/* huffWideTable10[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x7000000a, 0x7000800a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x0600000a, 0x0600400a, 0x00000000, 0x00000000, 0x1700000a, 0x1700400a, 0x1700800a, 0x1700c00a,
+	0x7100000a, 0x7100400a, 0x7100800a, 0x7100c00a, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x1600000a, 0x1600400a, 0x1600800a, 0x1600c00a, 0x6100000a, 0x6100400a, 0x6100800a, 0x6100c00a,
+	0x60000009, 0x60000019, 0x60008009, 0x60008019, 0x0500000a, 0x0500400a, 0x5000000a, 0x5000800a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0400000a, 0x0400400a,
+	0x1400000a, 0x1400400a, 0x1400800a, 0x1400c00a, 0x4100000a, 0x4100400a, 0x4100800a, 0x4100c00a,
+	0x40000009, 0x40000019, 0x40008009, 0x40008019, 0x2300000a, 0x2300400a, 0x2300800a, 0x2300c00a,
+	0x3200000a, 0x3200400a, 0x3200800a, 0x3200c00a, 0x03000009, 0x03000019, 0x03004009, 0x03004019,
+	0x13000009, 0x13000019, 0x13004009, 0x13004019, 0x13008009, 0x13008019, 0x1300c009, 0x1300c019,
+	0x31000009, 0x31000019, 0x31004009, 0x31004019, 0x31008009, 0x31008019, 0x3100c009, 0x3100c019,
+	0x30000008, 0x30000008, 0x30000018, 0x30000018, 0x30008008, 0x30008008, 0x30008018, 0x30008018,
+	0x22000009, 0x22000019, 0x22004009, 0x22004019, 0x22008009, 0x22008019, 0x2200c009, 0x2200c019,
+	0x12000008, 0x12000008, 0x12000018, 0x12000018, 0x12004008, 0x12004008, 0x12004018, 0x12004018,
+	0x12008008, 0x12008008, 0x12008018, 0x12008018, 0x1200c008, 0x1200c008, 0x1200c018, 0x1200c018,
+	0x21000008, 0x21000008, 0x21000018, 0x21000018, 0x21004008, 0x21004008, 0x21004018, 0x21004018,
+	0x21008008, 0x21008008, 0x21008018, 0x21008018, 0x2100c008, 0x2100c008, 0x2100c018, 0x2100c018,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000017, 0x02000017, 0x02000017, 0x02000017,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004017, 0x02004017, 0x02004017, 0x02004017,
+	0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000017, 0x20000017, 0x20000017, 0x20000017,
+	0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008017, 0x20008017, 0x20008017, 0x20008017,
+	0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11010046, 0x11011046, 0x11100046, 0x11102046,
+	0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016,
+	0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11014046, 0x11015046, 0x11104046, 0x11106046,
+	0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016,
+	0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11018046, 0x11019046, 0x11108046, 0x1110a046,
+	0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016,
+	0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1101c046, 0x1101d046, 0x1110c046, 0x1110e046,
+	0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01110064, 0x01111064, 0x01112064, 0x01113064,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014, 0x01000014,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01114064, 0x01115064, 0x01116064, 0x01117064,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014, 0x01004014,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10110064, 0x10111064, 0x10112064, 0x10113064,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10118064, 0x10119064, 0x1011a064, 0x1011b064,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00600091, 0x00602091, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00400091, 0x00402091, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00030091, 0x00031091,
+	0x00130091, 0x00131091, 0x00132091, 0x00133091, 0x00310091, 0x00311091, 0x00312091, 0x00313091,
+	0x00300081, 0x00300081, 0x00302081, 0x00302081, 0x00220091, 0x00221091, 0x00222091, 0x00223091,
+	0x00120081, 0x00120081, 0x00121081, 0x00121081, 0x00122081, 0x00122081, 0x00123081, 0x00123081,
+	0x00210081, 0x00210081, 0x00211081, 0x00211081, 0x00212081, 0x00212081, 0x00213081, 0x00213081,
+	0x00020071, 0x00020071, 0x00020071, 0x00020071, 0x00021071, 0x00021071, 0x00021071, 0x00021071,
+	0x00200071, 0x00200071, 0x00200071, 0x00200071, 0x00202071, 0x00202071, 0x00202071, 0x00202071,
+	0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061,
+	0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061,
+	0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061,
+	0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041, 0x00010041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041, 0x00011041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* huffWideTable11[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2700000a, 0x2700400a, 0x2700800a, 0x2700c00a,
+	0x7200000a, 0x7200400a, 0x7200800a, 0x7200c00a, 0x00000000, 0x00000000, 0x0700000a, 0x0700400a,
+	0x71000009, 0x71000009, 0x71004009, 0x71004009, 0x71008009, 0x71008009, 0x7100c009, 0x7100c009,
+	0x1700000a, 0x1700400a, 0x1700800a, 0x1700c00a, 0x70000009, 0x70000009, 0x70008009, 0x70008009,
+	0x3600000a, 0x3600400a, 0x3600800a, 0x3600c00a, 0x6300000a, 0x6300400a, 0x6300800a, 0x6300c00a,
+	0x60000009, 0x60000009, 0x60008009, 0x60008009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x0500000a, 0x0500400a, 0x1500000a, 0x1500400a, 0x1500800a, 0x1500c00a,
+	0x62000009, 0x62000009, 0x62004009, 0x62004009, 0x62008009, 0x62008009, 0x6200c009, 0x6200c009,
+	0x2600000a, 0x2600400a, 0x2600800a, 0x2600c00a, 0x06000009, 0x06000009, 0x06004009, 0x06004009,
+	0x16000009, 0x16000009, 0x16004009, 0x16004009, 0x16008009, 0x16008009, 0x1600c009, 0x1600c009,
+	0x61000009, 0x61000009, 0x61004009, 0x61004009, 0x61008009, 0x61008009, 0x6100c009, 0x6100c009,
+	0x5100000a, 0x5100400a, 0x5100800a, 0x5100c00a, 0x3400000a, 0x3400400a, 0x3400800a, 0x3400c00a,
+	0x50000009, 0x50000009, 0x50008009, 0x50008009, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2400000a, 0x2400400a, 0x2400800a, 0x2400c00a, 0x4200000a, 0x4200400a, 0x4200800a, 0x4200c00a,
+	0x1400000a, 0x1400400a, 0x1400800a, 0x1400c00a, 0x4100000a, 0x4100400a, 0x4100800a, 0x4100c00a,
+	0x04000009, 0x04000009, 0x04004009, 0x04004009, 0x40000009, 0x40000009, 0x40008009, 0x40008009,
+	0x23000009, 0x23000009, 0x23004009, 0x23004009, 0x23008009, 0x23008009, 0x2300c009, 0x2300c009,
+	0x32000009, 0x32000009, 0x32004009, 0x32004009, 0x32008009, 0x32008009, 0x3200c009, 0x3200c009,
+	0x13000008, 0x13000008, 0x13000008, 0x13000028, 0x13004008, 0x13004008, 0x13004008, 0x13004028,
+	0x13008008, 0x13008008, 0x13008008, 0x13008028, 0x1300c008, 0x1300c008, 0x1300c008, 0x1300c028,
+	0x31000008, 0x31000008, 0x31000008, 0x31000028, 0x31004008, 0x31004008, 0x31004008, 0x31004028,
+	0x31008008, 0x31008008, 0x31008008, 0x31008028, 0x3100c008, 0x3100c008, 0x3100c008, 0x3100c028,
+	0x03000008, 0x03000008, 0x03000008, 0x03000028, 0x03004008, 0x03004008, 0x03004008, 0x03004028,
+	0x30000008, 0x30000008, 0x30000008, 0x30000028, 0x30008008, 0x30008008, 0x30008008, 0x30008028,
+	0x22000008, 0x22000008, 0x22000008, 0x22000028, 0x22004008, 0x22004008, 0x22004008, 0x22004028,
+	0x22008008, 0x22008008, 0x22008008, 0x22008028, 0x2200c008, 0x2200c008, 0x2200c008, 0x2200c028,
+	0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000027, 0x21000027,
+	0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004027, 0x21004027,
+	0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008027, 0x21008027,
+	0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c027, 0x2100c027,
+	0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006,
+	0x12010046, 0x12011046, 0x12100046, 0x12102046, 0x12000026, 0x12000026, 0x12000026, 0x12000026,
+	0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006,
+	0x12014046, 0x12015046, 0x12104046, 0x12106046, 0x12004026, 0x12004026, 0x12004026, 0x12004026,
+	0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006,
+	0x12018046, 0x12019046, 0x12108046, 0x1210a046, 0x12008026, 0x12008026, 0x12008026, 0x12008026,
+	0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006,
+	0x1201c046, 0x1201d046, 0x1210c046, 0x1210e046, 0x1200c026, 0x1200c026, 0x1200c026, 0x1200c026,
+	0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006,
+	0x02010046, 0x02011046, 0x02100046, 0x02102046, 0x02000026, 0x02000026, 0x02000026, 0x02000026,
+	0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006,
+	0x02014046, 0x02015046, 0x02104046, 0x02106046, 0x02004026, 0x02004026, 0x02004026, 0x02004026,
+	0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006,
+	0x20010046, 0x20011046, 0x20100046, 0x20102046, 0x20000026, 0x20000026, 0x20000026, 0x20000026,
+	0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006,
+	0x20018046, 0x20019046, 0x20108046, 0x2010a046, 0x20008026, 0x20008026, 0x20008026, 0x20008026,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11110055, 0x11111055, 0x11112055, 0x11113055,
+	0x11010045, 0x11010045, 0x11011045, 0x11011045, 0x11100045, 0x11100045, 0x11102045, 0x11102045,
+	0x11000025, 0x11000025, 0x11000025, 0x11000025, 0x11000025, 0x11000025, 0x11000025, 0x11000025,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11114055, 0x11115055, 0x11116055, 0x11117055,
+	0x11014045, 0x11014045, 0x11015045, 0x11015045, 0x11104045, 0x11104045, 0x11106045, 0x11106045,
+	0x11004025, 0x11004025, 0x11004025, 0x11004025, 0x11004025, 0x11004025, 0x11004025, 0x11004025,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11118055, 0x11119055, 0x1111a055, 0x1111b055,
+	0x11018045, 0x11018045, 0x11019045, 0x11019045, 0x11108045, 0x11108045, 0x1110a045, 0x1110a045,
+	0x11008025, 0x11008025, 0x11008025, 0x11008025, 0x11008025, 0x11008025, 0x11008025, 0x11008025,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1111c055, 0x1111d055, 0x1111e055, 0x1111f055,
+	0x1101c045, 0x1101c045, 0x1101d045, 0x1101d045, 0x1110c045, 0x1110c045, 0x1110e045, 0x1110e045,
+	0x1100c025, 0x1100c025, 0x1100c025, 0x1100c025, 0x1100c025, 0x1100c025, 0x1100c025, 0x1100c025,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01120064, 0x01121064, 0x01122064, 0x01123064, 0x01020064, 0x01021064, 0x01200064, 0x01202064,
+	0x01110054, 0x01110054, 0x01111054, 0x01111054, 0x01112054, 0x01112054, 0x01113054, 0x01113054,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024,
+	0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024, 0x01000024,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01124064, 0x01125064, 0x01126064, 0x01127064, 0x01024064, 0x01025064, 0x01204064, 0x01206064,
+	0x01114054, 0x01114054, 0x01115054, 0x01115054, 0x01116054, 0x01116054, 0x01117054, 0x01117054,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024,
+	0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024, 0x01004024,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10120064, 0x10121064, 0x10122064, 0x10123064, 0x10020064, 0x10021064, 0x10200064, 0x10202064,
+	0x10110054, 0x10110054, 0x10111054, 0x10111054, 0x10112054, 0x10112054, 0x10113054, 0x10113054,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024,
+	0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024, 0x10000024,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10128064, 0x10129064, 0x1012a064, 0x1012b064, 0x10028064, 0x10029064, 0x10208064, 0x1020a064,
+	0x10118054, 0x10118054, 0x10119054, 0x10119054, 0x1011a054, 0x1011a054, 0x1011b054, 0x1011b054,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024,
+	0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024, 0x10008024,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+	0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+	0x00130082, 0x00131082, 0x00132082, 0x00133082, 0x00310082, 0x00311082, 0x00312082, 0x00313082,
+	0x00030082, 0x00031082, 0x00300082, 0x00302082, 0x00220082, 0x00221082, 0x00222082, 0x00223082,
+	0x00210072, 0x00210072, 0x00211072, 0x00211072, 0x00212072, 0x00212072, 0x00213072, 0x00213072,
+	0x00120062, 0x00120062, 0x00120062, 0x00120062, 0x00121062, 0x00121062, 0x00121062, 0x00121062,
+	0x00122062, 0x00122062, 0x00122062, 0x00122062, 0x00123062, 0x00123062, 0x00123062, 0x00123062,
+	0x00020062, 0x00020062, 0x00020062, 0x00020062, 0x00021062, 0x00021062, 0x00021062, 0x00021062,
+	0x00200062, 0x00200062, 0x00200062, 0x00200062, 0x00202062, 0x00202062, 0x00202062, 0x00202062,
+	0x00110052, 0x00110052, 0x00110052, 0x00110052, 0x00110052, 0x00110052, 0x00110052, 0x00110052,
+	0x00111052, 0x00111052, 0x00111052, 0x00111052, 0x00111052, 0x00111052, 0x00111052, 0x00111052,
+	0x00112052, 0x00112052, 0x00112052, 0x00112052, 0x00112052, 0x00112052, 0x00112052, 0x00112052,
+	0x00113052, 0x00113052, 0x00113052, 0x00113052, 0x00113052, 0x00113052, 0x00113052, 0x00113052,
+	0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042,
+	0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042, 0x00010042,
+	0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042,
+	0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042, 0x00011042,
+	0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042,
+	0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042, 0x00100042,
+	0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042,
+	0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042, 0x00102042,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022, 0x00000022,
+	/* huffWideTable12[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x5600000a, 0x5600400a, 0x5600800a, 0x5600c00a, 0x3700000a, 0x3700400a, 0x3700800a, 0x3700c00a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2700000a, 0x2700400a, 0x2700800a, 0x2700c00a,
+	0x7200000a, 0x7200400a, 0x7200800a, 0x7200c00a, 0x4600000a, 0x4600400a, 0x4600800a, 0x4600c00a,
+	0x6400000a, 0x6400400a, 0x6400800a, 0x6400c00a, 0x1700000a, 0x1700400a, 0x1700800a, 0x1700c00a,
+	0x7100000a, 0x7100400a, 0x7100800a, 0x7100c00a, 0x0700000a, 0x0700400a, 0x7000000a, 0x7000800a,
+	0x3600000a, 0x3600400a, 0x3600800a, 0x3600c00a, 0x6300000a, 0x6300400a, 0x6300800a, 0x6300c00a,
+	0x4500000a, 0x4500400a, 0x4500800a, 0x4500c00a, 0x5400000a, 0x5400400a, 0x5400800a, 0x5400c00a,
+	0x4400000a, 0x4400400a, 0x4400800a, 0x4400c00a, 0x0600000a, 0x0600400a, 0x0500000a, 0x0500400a,
+	0x26000009, 0x26000009, 0x26004009, 0x26004009, 0x26008009, 0x26008009, 0x2600c009, 0x2600c009,
+	0x62000009, 0x62000009, 0x62004009, 0x62004009, 0x62008009, 0x62008009, 0x6200c009, 0x6200c009,
+	0x61000009, 0x61000009, 0x61004009, 0x61004009, 0x61008009, 0x61008009, 0x6100c009, 0x6100c009,
+	0x1600000a, 0x1600400a, 0x1600800a, 0x1600c00a, 0x60000009, 0x60000009, 0x60008009, 0x60008009,
+	0x3500000a, 0x3500400a, 0x3500800a, 0x3500c00a, 0x5300000a, 0x5300400a, 0x5300800a, 0x5300c00a,
+	0x2500000a, 0x2500400a, 0x2500800a, 0x2500c00a, 0x5200000a, 0x5200400a, 0x5200800a, 0x5200c00a,
+	0x15000009, 0x15000009, 0x15004009, 0x15004009, 0x15008009, 0x15008009, 0x1500c009, 0x1500c009,
+	0x51000009, 0x51000009, 0x51004009, 0x51004009, 0x51008009, 0x51008009, 0x5100c009, 0x5100c009,
+	0x34000009, 0x34000009, 0x34004009, 0x34004009, 0x34008009, 0x34008009, 0x3400c009, 0x3400c009,
+	0x43000009, 0x43000009, 0x43004009, 0x43004009, 0x43008009, 0x43008009, 0x4300c009, 0x4300c009,
+	0x50000009, 0x50000009, 0x50008009, 0x50008009, 0x04000009, 0x04000009, 0x04004009, 0x04004009,
+	0x24000009, 0x24000009, 0x24004009, 0x24004009, 0x24008009, 0x24008009, 0x2400c009, 0x2400c009,
+	0x42000009, 0x42000009, 0x42004009, 0x42004009, 0x42008009, 0x42008009, 0x4200c009, 0x4200c009,
+	0x14000009, 0x14000009, 0x14004009, 0x14004009, 0x14008009, 0x14008009, 0x1400c009, 0x1400c009,
+	0x33000008, 0x33000008, 0x33000008, 0x33000008, 0x33004008, 0x33004008, 0x33004008, 0x33004008,
+	0x33008008, 0x33008008, 0x33008008, 0x33008008, 0x3300c008, 0x3300c008, 0x3300c008, 0x3300c008,
+	0x41000008, 0x41000008, 0x41000008, 0x41000008, 0x41004008, 0x41004008, 0x41004008, 0x41004008,
+	0x41008008, 0x41008008, 0x41008008, 0x41008008, 0x4100c008, 0x4100c008, 0x4100c008, 0x4100c008,
+	0x23000008, 0x23000008, 0x23000008, 0x23000008, 0x23004008, 0x23004008, 0x23004008, 0x23004008,
+	0x23008008, 0x23008008, 0x23008008, 0x23008008, 0x2300c008, 0x2300c008, 0x2300c008, 0x2300c008,
+	0x32000008, 0x32000008, 0x32000008, 0x32000008, 0x32004008, 0x32004008, 0x32004008, 0x32004008,
+	0x32008008, 0x32008008, 0x32008008, 0x32008008, 0x3200c008, 0x3200c008, 0x3200c008, 0x3200c008,
+	0x40000008, 0x40000008, 0x40000008, 0x40000008, 0x40008008, 0x40008008, 0x40008008, 0x40008008,
+	0x03000008, 0x03000008, 0x03000008, 0x03000008, 0x03004008, 0x03004008, 0x03004008, 0x03004008,
+	0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007,
+	0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007,
+	0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007, 0x13000007,
+	0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007, 0x13004007,
+	0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007, 0x13008007,
+	0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007, 0x1300c007,
+	0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000007,
+	0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007, 0x31004007,
+	0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007, 0x31008007,
+	0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007, 0x3100c007,
+	0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007,
+	0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007,
+	0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007,
+	0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007,
+	0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006, 0x12000006,
+	0x12000006, 0x12000046, 0x12000006, 0x12000006, 0x12010046, 0x12011046, 0x12100046, 0x12102046,
+	0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006, 0x12004006,
+	0x12004006, 0x12004046, 0x12004006, 0x12004006, 0x12014046, 0x12015046, 0x12104046, 0x12106046,
+	0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006, 0x12008006,
+	0x12008006, 0x12008046, 0x12008006, 0x12008006, 0x12018046, 0x12019046, 0x12108046, 0x1210a046,
+	0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006, 0x1200c006,
+	0x1200c006, 0x1200c046, 0x1200c006, 0x1200c006, 0x1201c046, 0x1201d046, 0x1210c046, 0x1210e046,
+	0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006, 0x21000006,
+	0x21000006, 0x21000046, 0x21000006, 0x21000006, 0x21010046, 0x21011046, 0x21100046, 0x21102046,
+	0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006, 0x21004006,
+	0x21004006, 0x21004046, 0x21004006, 0x21004006, 0x21014046, 0x21015046, 0x21104046, 0x21106046,
+	0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006, 0x21008006,
+	0x21008006, 0x21008046, 0x21008006, 0x21008006, 0x21018046, 0x21019046, 0x21108046, 0x2110a046,
+	0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006, 0x2100c006,
+	0x2100c006, 0x2100c046, 0x2100c006, 0x2100c006, 0x2101c046, 0x2101d046, 0x2110c046, 0x2110e046,
+	0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006,
+	0x02000006, 0x02000046, 0x02000006, 0x02000006, 0x02010046, 0x02011046, 0x02100046, 0x02102046,
+	0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006,
+	0x02004006, 0x02004046, 0x02004006, 0x02004006, 0x02014046, 0x02015046, 0x02104046, 0x02106046,
+	0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006,
+	0x20000006, 0x20000046, 0x20000006, 0x20000006, 0x20010046, 0x20011046, 0x20100046, 0x20102046,
+	0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006,
+	0x20008006, 0x20008046, 0x20008006, 0x20008006, 0x20018046, 0x20019046, 0x20108046, 0x2010a046,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00120064, 0x00121064, 0x00122064, 0x00123064, 0x00210064, 0x00211064, 0x00212064, 0x00213064,
+	0x00020064, 0x00021064, 0x00200064, 0x00202064, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+	0x00110054, 0x00110054, 0x00111054, 0x00111054, 0x00112054, 0x00112054, 0x00113054, 0x00113054,
+	0x00010044, 0x00010044, 0x00010044, 0x00010044, 0x00011044, 0x00011044, 0x00011044, 0x00011044,
+	0x00100044, 0x00100044, 0x00100044, 0x00100044, 0x00102044, 0x00102044, 0x00102044, 0x00102044,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11000005, 0x11000005, 0x11000045, 0x11000045, 0x11110055, 0x11111055, 0x11112055, 0x11113055,
+	0x11010045, 0x11010045, 0x11011045, 0x11011045, 0x11100045, 0x11100045, 0x11102045, 0x11102045,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005,
+	0x11004005, 0x11004005, 0x11004045, 0x11004045, 0x11114055, 0x11115055, 0x11116055, 0x11117055,
+	0x11014045, 0x11014045, 0x11015045, 0x11015045, 0x11104045, 0x11104045, 0x11106045, 0x11106045,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005,
+	0x11008005, 0x11008005, 0x11008045, 0x11008045, 0x11118055, 0x11119055, 0x1111a055, 0x1111b055,
+	0x11018045, 0x11018045, 0x11019045, 0x11019045, 0x11108045, 0x11108045, 0x1110a045, 0x1110a045,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005,
+	0x1100c005, 0x1100c005, 0x1100c045, 0x1100c045, 0x1111c055, 0x1111d055, 0x1111e055, 0x1111f055,
+	0x1101c045, 0x1101c045, 0x1101d045, 0x1101d045, 0x1110c045, 0x1110c045, 0x1110e045, 0x1110e045,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004, 0x01000004,
+	0x01120064, 0x01121064, 0x01122064, 0x01123064, 0x01210064, 0x01211064, 0x01212064, 0x01213064,
+	0x01020064, 0x01021064, 0x01200064, 0x01202064, 0x01000044, 0x01000044, 0x01000044, 0x01000044,
+	0x01110054, 0x01110054, 0x01111054, 0x01111054, 0x01112054, 0x01112054, 0x01113054, 0x01113054,
+	0x01010044, 0x01010044, 0x01010044, 0x01010044, 0x01011044, 0x01011044, 0x01011044, 0x01011044,
+	0x01100044, 0x01100044, 0x01100044, 0x01100044, 0x01102044, 0x01102044, 0x01102044, 0x01102044,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004, 0x01004004,
+	0x01124064, 0x01125064, 0x01126064, 0x01127064, 0x01214064, 0x01215064, 0x01216064, 0x01217064,
+	0x01024064, 0x01025064, 0x01204064, 0x01206064, 0x01004044, 0x01004044, 0x01004044, 0x01004044,
+	0x01114054, 0x01114054, 0x01115054, 0x01115054, 0x01116054, 0x01116054, 0x01117054, 0x01117054,
+	0x01014044, 0x01014044, 0x01014044, 0x01014044, 0x01015044, 0x01015044, 0x01015044, 0x01015044,
+	0x01104044, 0x01104044, 0x01104044, 0x01104044, 0x01106044, 0x01106044, 0x01106044, 0x01106044,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10120064, 0x10121064, 0x10122064, 0x10123064, 0x10210064, 0x10211064, 0x10212064, 0x10213064,
+	0x10020064, 0x10021064, 0x10200064, 0x10202064, 0x10000044, 0x10000044, 0x10000044, 0x10000044,
+	0x10110054, 0x10110054, 0x10111054, 0x10111054, 0x10112054, 0x10112054, 0x10113054, 0x10113054,
+	0x10010044, 0x10010044, 0x10010044, 0x10010044, 0x10011044, 0x10011044, 0x10011044, 0x10011044,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10128064, 0x10129064, 0x1012a064, 0x1012b064, 0x10218064, 0x10219064, 0x1021a064, 0x1021b064,
+	0x10028064, 0x10029064, 0x10208064, 0x1020a064, 0x10008044, 0x10008044, 0x10008044, 0x10008044,
+	0x10118054, 0x10118054, 0x10119054, 0x10119054, 0x1011a054, 0x1011a054, 0x1011b054, 0x1011b054,
+	0x10018044, 0x10018044, 0x10018044, 0x10018044, 0x10019044, 0x10019044, 0x10019044, 0x10019044,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	/* huffWideTable13[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x8100000a, 0x8100400a, 0x8100800a, 0x8100c00a, 0x0800000a, 0x0800400a, 0x8000000a, 0x8000800a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0600000a, 0x0600400a, 0x6000000a, 0x6000800a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0500000a, 0x0500400a,
+	0x1500000a, 0x1500400a, 0x1500800a, 0x1500c00a, 0x5100000a, 0x5100400a, 0x5100800a, 0x5100c00a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5000000a, 0x5000800a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1400000a, 0x1400400a, 0x1400800a, 0x1400c00a,
+	0x41000009, 0x41000019, 0x41004009, 0x41004019, 0x41008009, 0x41008019, 0x4100c009, 0x4100c019,
+	0x04000009, 0x04000019, 0x04004009, 0x04004019, 0x40000009, 0x40000019, 0x40008009, 0x40008019,
+	0x2300000a, 0x2300400a, 0x2300800a, 0x2300c00a, 0x3200000a, 0x3200400a, 0x3200800a, 0x3200c00a,
+	0x13000009, 0x13000019, 0x13004009, 0x13004019, 0x13008009, 0x13008019, 0x1300c009, 0x1300c019,
+	0x31000009, 0x31000019, 0x31004009, 0x31004019, 0x31008009, 0x31008019, 0x3100c009, 0x3100c019,
+	0x03000008, 0x03000008, 0x03000018, 0x03000018, 0x03004008, 0x03004008, 0x03004018, 0x03004018,
+	0x30000008, 0x30000008, 0x30000018, 0x30000018, 0x30008008, 0x30008008, 0x30008018, 0x30008018,
+	0x22000009, 0x22000019, 0x22004009, 0x22004019, 0x22008009, 0x22008019, 0x2200c009, 0x2200c019,
+	0x12000008, 0x12000008, 0x12000018, 0x12000018, 0x12004008, 0x12004008, 0x12004018, 0x12004018,
+	0x12008008, 0x12008008, 0x12008018, 0x12008018, 0x1200c008, 0x1200c008, 0x1200c018, 0x1200c018,
+	0x21000008, 0x21000008, 0x21000018, 0x21000018, 0x21004008, 0x21004008, 0x21004018, 0x21004018,
+	0x21008008, 0x21008008, 0x21008018, 0x21008018, 0x2100c008, 0x2100c008, 0x2100c018, 0x2100c018,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000017, 0x02000017, 0x02000017, 0x02000017,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004017, 0x02004017, 0x02004017, 0x02004017,
+	0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000017, 0x20000017, 0x20000017, 0x20000017,
+	0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008017, 0x20008017, 0x20008017, 0x20008017,
+	0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11100046, 0x11102046,
+	0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016,
+	0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11104046, 0x11106046,
+	0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016,
+	0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11108046, 0x1110a046,
+	0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016,
+	0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1110c046, 0x1110e046,
+	0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005,
+	0x01000005, 0x01000005, 0x01010055, 0x01011055, 0x01100045, 0x01100045, 0x01102045, 0x01102045,
+	0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015,
+	0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005,
+	0x01004005, 0x01004005, 0x01014055, 0x01015055, 0x01104045, 0x01104045, 0x01106045, 0x01106045,
+	0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015,
+	0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10110064, 0x10111064, 0x10112064, 0x10113064, 0x10010054, 0x10010054, 0x10011054, 0x10011054,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10118064, 0x10119064, 0x1011a064, 0x1011b064, 0x10018054, 0x10018054, 0x10019054, 0x10019054,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00410091, 0x00411091, 0x00412091, 0x00413091, 0x00040091, 0x00041091, 0x00400091, 0x00402091,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00130091, 0x00131091, 0x00132091, 0x00133091,
+	0x00310091, 0x00311091, 0x00312091, 0x00313091, 0x00030081, 0x00030081, 0x00031081, 0x00031081,
+	0x00300081, 0x00300081, 0x00302081, 0x00302081, 0x00220091, 0x00221091, 0x00222091, 0x00223091,
+	0x00120081, 0x00120081, 0x00121081, 0x00121081, 0x00122081, 0x00122081, 0x00123081, 0x00123081,
+	0x00210081, 0x00210081, 0x00211081, 0x00211081, 0x00212081, 0x00212081, 0x00213081, 0x00213081,
+	0x00020071, 0x00020071, 0x00020071, 0x00020071, 0x00021071, 0x00021071, 0x00021071, 0x00021071,
+	0x00200071, 0x00200071, 0x00200071, 0x00200071, 0x00202071, 0x00202071, 0x00202071, 0x00202071,
+	0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061,
+	0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061,
+	0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061,
+	0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061,
+	0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051,
+	0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051,
+	0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051,
+	0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* huffWideTable15[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x9100000a, 0x9100400a, 0x9100800a, 0x9100c00a, 0x00000000, 0x00000000, 0x9000000a, 0x9000800a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2800000a, 0x2800400a, 0x2800800a, 0x2800c00a, 0x8200000a, 0x8200400a, 0x8200800a, 0x8200c00a,
+	0x1800000a, 0x1800400a, 0x1800800a, 0x1800c00a, 0x8100000a, 0x8100400a, 0x8100800a, 0x8100c00a,
+	0x00000000, 0x00000000, 0x0800000a, 0x0800400a, 0x8000000a, 0x8000800a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x2700000a, 0x2700400a, 0x2700800a, 0x2700c00a, 0x7200000a, 0x7200400a, 0x7200800a, 0x7200c00a,
+	0x6400000a, 0x6400400a, 0x6400800a, 0x6400c00a, 0x1700000a, 0x1700400a, 0x1700800a, 0x1700c00a,
+	0x5500000a, 0x5500400a, 0x5500800a, 0x5500c00a, 0x7100000a, 0x7100400a, 0x7100800a, 0x7100c00a,
+	0x0700000a, 0x0700400a, 0x7000000a, 0x7000800a, 0x3600000a, 0x3600400a, 0x3600800a, 0x3600c00a,
+	0x6300000a, 0x6300400a, 0x6300800a, 0x6300c00a, 0x4500000a, 0x4500400a, 0x4500800a, 0x4500c00a,
+	0x5400000a, 0x5400400a, 0x5400800a, 0x5400c00a, 0x2600000a, 0x2600400a, 0x2600800a, 0x2600c00a,
+	0x6200000a, 0x6200400a, 0x6200800a, 0x6200c00a, 0x1600000a, 0x1600400a, 0x1600800a, 0x1600c00a,
+	0x0600000a, 0x0600400a, 0x6000000a, 0x6000800a, 0x3500000a, 0x3500400a, 0x3500800a, 0x3500c00a,
+	0x61000009, 0x61000009, 0x61004009, 0x61004009, 0x61008009, 0x61008009, 0x6100c009, 0x6100c009,
+	0x5300000a, 0x5300400a, 0x5300800a, 0x5300c00a, 0x4400000a, 0x4400400a, 0x4400800a, 0x4400c00a,
+	0x25000009, 0x25000009, 0x25004009, 0x25004009, 0x25008009, 0x25008009, 0x2500c009, 0x2500c009,
+	0x52000009, 0x52000009, 0x52004009, 0x52004009, 0x52008009, 0x52008009, 0x5200c009, 0x5200c009,
+	0x15000009, 0x15000009, 0x15004009, 0x15004009, 0x15008009, 0x15008009, 0x1500c009, 0x1500c009,
+	0x51000009, 0x51000009, 0x51004009, 0x51004009, 0x51008009, 0x51008009, 0x5100c009, 0x5100c009,
+	0x05000009, 0x05000009, 0x05004009, 0x05004009, 0x50000009, 0x50000009, 0x50008009, 0x50008009,
+	0x34000009, 0x34000009, 0x34004009, 0x34004009, 0x34008009, 0x34008009, 0x3400c009, 0x3400c009,
+	0x43000009, 0x43000009, 0x43004009, 0x43004009, 0x43008009, 0x43008009, 0x4300c009, 0x4300c009,
+	0x24000009, 0x24000009, 0x24004009, 0x24004009, 0x24008009, 0x24008009, 0x2400c009, 0x2400c009,
+	0x42000009, 0x42000009, 0x42004009, 0x42004009, 0x42008009, 0x42008009, 0x4200c009, 0x4200c009,
+	0x33000009, 0x33000009, 0x33004009, 0x33004009, 0x33008009, 0x33008009, 0x3300c009, 0x3300c009,
+	0x41000008, 0x41000008, 0x41000008, 0x41000008, 0x41004008, 0x41004008, 0x41004008, 0x41004008,
+	0x41008008, 0x41008008, 0x41008008, 0x41008008, 0x4100c008, 0x4100c008, 0x4100c008, 0x4100c008,
+	0x14000009, 0x14000009, 0x14004009, 0x14004009, 0x14008009, 0x14008009, 0x1400c009, 0x1400c009,
+	0x04000008, 0x04000008, 0x04000008, 0x04000008, 0x04004008, 0x04004008, 0x04004008, 0x04004008,
+	0x23000008, 0x23000008, 0x23000008, 0x23000008, 0x23004008, 0x23004008, 0x23004008, 0x23004008,
+	0x23008008, 0x23008008, 0x23008008, 0x23008008, 0x2300c008, 0x2300c008, 0x2300c008, 0x2300c008,
+	0x32000008, 0x32000008, 0x32000008, 0x32000008, 0x32004008, 0x32004008, 0x32004008, 0x32004008,
+	0x32008008, 0x32008008, 0x32008008, 0x32008008, 0x3200c008, 0x3200c008, 0x3200c008, 0x3200c008,
+	0x40000008, 0x40000008, 0x40000008, 0x40000008, 0x40008008, 0x40008008, 0x40008008, 0x40008008,
+	0x03000008, 0x03000008, 0x03000008, 0x03000008, 0x03004008, 0x03004008, 0x03004008, 0x03004008,
+	0x13000008, 0x13000008, 0x13000008, 0x13000008, 0x13004008, 0x13004008, 0x13004008, 0x13004008,
+	0x13008008, 0x13008008, 0x13008008, 0x13008008, 0x1300c008, 0x1300c008, 0x1300c008, 0x1300c008,
+	0x31000008, 0x31000008, 0x31000008, 0x31000008, 0x31004008, 0x31004008, 0x31004008, 0x31004008,
+	0x31008008, 0x31008008, 0x31008008, 0x31008008, 0x3100c008, 0x3100c008, 0x3100c008, 0x3100c008,
+	0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000037,
+	0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008007, 0x30008037,
+	0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000007, 0x22000037,
+	0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004007, 0x22004037,
+	0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008007, 0x22008037,
+	0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c007, 0x2200c037,
+	0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000037,
+	0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004037,
+	0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008037,
+	0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c037,
+	0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000037,
+	0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004037,
+	0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008037,
+	0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c037,
+	0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006,
+	0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000006, 0x02000036, 0x02000036,
+	0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006,
+	0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004006, 0x02004036, 0x02004036,
+	0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006,
+	0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000006, 0x20000036, 0x20000036,
+	0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006,
+	0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008006, 0x20008036, 0x20008036,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11110055, 0x11111055, 0x11112055, 0x11113055,
+	0x11010055, 0x11011055, 0x11100055, 0x11102055, 0x11000035, 0x11000035, 0x11000035, 0x11000035,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11004005,
+	0x11004005, 0x11004005, 0x11004005, 0x11004005, 0x11114055, 0x11115055, 0x11116055, 0x11117055,
+	0x11014055, 0x11015055, 0x11104055, 0x11106055, 0x11004035, 0x11004035, 0x11004035, 0x11004035,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11008005,
+	0x11008005, 0x11008005, 0x11008005, 0x11008005, 0x11118055, 0x11119055, 0x1111a055, 0x1111b055,
+	0x11018055, 0x11019055, 0x11108055, 0x1110a055, 0x11008035, 0x11008035, 0x11008035, 0x11008035,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005,
+	0x1100c005, 0x1100c005, 0x1100c005, 0x1100c005, 0x1111c055, 0x1111d055, 0x1111e055, 0x1111f055,
+	0x1101c055, 0x1101d055, 0x1110c055, 0x1110e055, 0x1100c035, 0x1100c035, 0x1100c035, 0x1100c035,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01110055, 0x01111055, 0x01112055, 0x01113055,
+	0x01010055, 0x01011055, 0x01100055, 0x01102055, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01114055, 0x01115055, 0x01116055, 0x01117055,
+	0x01014055, 0x01015055, 0x01104055, 0x01106055, 0x01004035, 0x01004035, 0x01004035, 0x01004035,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10110055, 0x10111055, 0x10112055, 0x10113055,
+	0x10010055, 0x10011055, 0x10100055, 0x10102055, 0x10000035, 0x10000035, 0x10000035, 0x10000035,
+	0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005,
+	0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005,
+	0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10118055, 0x10119055, 0x1011a055, 0x1011b055,
+	0x10018055, 0x10019055, 0x10108055, 0x1010a055, 0x10008035, 0x10008035, 0x10008035, 0x10008035,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+	0x00000003, 0x00000003, 0x00300073, 0x00302073, 0x00220073, 0x00221073, 0x00222073, 0x00223073,
+	0x00120073, 0x00121073, 0x00122073, 0x00123073, 0x00210073, 0x00211073, 0x00212073, 0x00213073,
+	0x00020063, 0x00020063, 0x00021063, 0x00021063, 0x00200063, 0x00200063, 0x00202063, 0x00202063,
+	0x00110053, 0x00110053, 0x00110053, 0x00110053, 0x00111053, 0x00111053, 0x00111053, 0x00111053,
+	0x00112053, 0x00112053, 0x00112053, 0x00112053, 0x00113053, 0x00113053, 0x00113053, 0x00113053,
+	0x00010053, 0x00010053, 0x00010053, 0x00010053, 0x00011053, 0x00011053, 0x00011053, 0x00011053,
+	0x00100053, 0x00100053, 0x00100053, 0x00100053, 0x00102053, 0x00102053, 0x00102053, 0x00102053,
+	0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+	0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+	/* huffWideTable16[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x5100000a, 0x5100400a, 0x5100800a, 0x5100c00a, 0x00000000, 0x00000000, 0x0500000a, 0x0500400a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5000000a, 0x5000800a, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1400000a, 0x1400400a, 0x1400800a, 0x1400c00a,
+	0x4100000a, 0x4100400a, 0x4100800a, 0x4100c00a, 0x0400000a, 0x0400400a, 0x4000000a, 0x4000800a,
+	0x2300000a, 0x2300400a, 0x2300800a, 0x2300c00a, 0x3200000a, 0x3200400a, 0x3200800a, 0x3200c00a,
+	0x13000009, 0x13000019, 0x13004009, 0x13004019, 0x13008009, 0x13008019, 0x1300c009, 0x1300c019,
+	0x31000009, 0x31000019, 0x31004009, 0x31004019, 0x31008009, 0x31008019, 0x3100c009, 0x3100c019,
+	0x03000009, 0x03000019, 0x03004009, 0x03004019, 0x30000009, 0x30000019, 0x30008009, 0x30008019,
+	0x22000009, 0x22000019, 0x22004009, 0x22004019, 0x22008009, 0x22008019, 0x2200c009, 0x2200c019,
+	0x12000008, 0x12000008, 0x12000018, 0x12000018, 0x12004008, 0x12004008, 0x12004018, 0x12004018,
+	0x12008008, 0x12008008, 0x12008018, 0x12008018, 0x1200c008, 0x1200c008, 0x1200c018, 0x1200c018,
+	0x21000008, 0x21000008, 0x21000018, 0x21000018, 0x21004008, 0x21004008, 0x21004018, 0x21004018,
+	0x21008008, 0x21008008, 0x21008018, 0x21008018, 0x2100c008, 0x2100c008, 0x2100c018, 0x2100c018,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000017, 0x02000017, 0x02000017, 0x02000017,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004017, 0x02004017, 0x02004017, 0x02004017,
+	0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000017, 0x20000017, 0x20000017, 0x20000017,
+	0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008017, 0x20008017, 0x20008017, 0x20008017,
+	0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11100046, 0x11102046,
+	0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016, 0x11000016,
+	0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11104046, 0x11106046,
+	0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016, 0x11004016,
+	0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11108046, 0x1110a046,
+	0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016, 0x11008016,
+	0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1110c046, 0x1110e046,
+	0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016, 0x1100c016,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005,
+	0x01000005, 0x01000005, 0x01010055, 0x01011055, 0x01100045, 0x01100045, 0x01102045, 0x01102045,
+	0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015,
+	0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015, 0x01000015,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005,
+	0x01004005, 0x01004005, 0x01014055, 0x01015055, 0x01104045, 0x01104045, 0x01106045, 0x01106045,
+	0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015,
+	0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015, 0x01004015,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004, 0x10000004,
+	0x10110064, 0x10111064, 0x10112064, 0x10113064, 0x10010054, 0x10010054, 0x10011054, 0x10011054,
+	0x10100044, 0x10100044, 0x10100044, 0x10100044, 0x10102044, 0x10102044, 0x10102044, 0x10102044,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014, 0x10000014,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004, 0x10008004,
+	0x10118064, 0x10119064, 0x1011a064, 0x1011b064, 0x10018054, 0x10018054, 0x10019054, 0x10019054,
+	0x10108044, 0x10108044, 0x10108044, 0x10108044, 0x1010a044, 0x1010a044, 0x1010a044, 0x1010a044,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014, 0x10008014,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00130091, 0x00131091, 0x00132091, 0x00133091, 0x00310091, 0x00311091, 0x00312091, 0x00313091,
+	0x00030091, 0x00031091, 0x00300091, 0x00302091, 0x00220091, 0x00221091, 0x00222091, 0x00223091,
+	0x00120081, 0x00120081, 0x00121081, 0x00121081, 0x00122081, 0x00122081, 0x00123081, 0x00123081,
+	0x00210081, 0x00210081, 0x00211081, 0x00211081, 0x00212081, 0x00212081, 0x00213081, 0x00213081,
+	0x00020071, 0x00020071, 0x00020071, 0x00020071, 0x00021071, 0x00021071, 0x00021071, 0x00021071,
+	0x00200071, 0x00200071, 0x00200071, 0x00200071, 0x00202071, 0x00202071, 0x00202071, 0x00202071,
+	0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061, 0x00110061,
+	0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061, 0x00111061,
+	0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061, 0x00112061,
+	0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061, 0x00113061,
+	0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051,
+	0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051, 0x00010051,
+	0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051,
+	0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051, 0x00011051,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041, 0x00100041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041, 0x00102041,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* huffWideTable24[1024] */
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7300000a, 0x7300400a, 0x7300800a, 0x7300c00a,
+	0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7200000a, 0x7200400a, 0x7200800a, 0x7200c00a,
+	0x4600000a, 0x4600400a, 0x4600800a, 0x4600c00a, 0x6400000a, 0x6400400a, 0x6400800a, 0x6400c00a,
+	0x5500000a, 0x5500400a, 0x5500800a, 0x5500c00a, 0x7100000a, 0x7100400a, 0x7100800a, 0x7100c00a,
+	0x3600000a, 0x3600400a, 0x3600800a, 0x3600c00a, 0x6300000a, 0x6300400a, 0x6300800a, 0x6300c00a,
+	0x4500000a, 0x4500400a, 0x4500800a, 0x4500c00a, 0x5400000a, 0x5400400a, 0x5400800a, 0x5400c00a,
+	0x2600000a, 0x2600400a, 0x2600800a, 0x2600c00a, 0x6200000a, 0x6200400a, 0x6200800a, 0x6200c00a,
+	0x1600000a, 0x1600400a, 0x1600800a, 0x1600c00a, 0x6100000a, 0x6100400a, 0x6100800a, 0x6100c00a,
+	0x0600000a, 0x0600400a, 0x6000000a, 0x6000800a, 0x3500000a, 0x3500400a, 0x3500800a, 0x3500c00a,
+	0x5300000a, 0x5300400a, 0x5300800a, 0x5300c00a, 0x4400000a, 0x4400400a, 0x4400800a, 0x4400c00a,
+	0x2500000a, 0x2500400a, 0x2500800a, 0x2500c00a, 0x5200000a, 0x5200400a, 0x5200800a, 0x5200c00a,
+	0x1500000a, 0x1500400a, 0x1500800a, 0x1500c00a, 0x0500000a, 0x0500400a, 0x5000000a, 0x5000800a,
+	0x51000009, 0x51000009, 0x51004009, 0x51004009, 0x51008009, 0x51008009, 0x5100c009, 0x5100c009,
+	0x3400000a, 0x3400400a, 0x3400800a, 0x3400c00a, 0x4300000a, 0x4300400a, 0x4300800a, 0x4300c00a,
+	0x24000009, 0x24000009, 0x24004009, 0x24004009, 0x24008009, 0x24008009, 0x2400c009, 0x2400c009,
+	0x42000009, 0x42000009, 0x42004009, 0x42004009, 0x42008009, 0x42008009, 0x4200c009, 0x4200c009,
+	0x33000009, 0x33000009, 0x33004009, 0x33004009, 0x33008009, 0x33008009, 0x3300c009, 0x3300c009,
+	0x14000009, 0x14000009, 0x14004009, 0x14004009, 0x14008009, 0x14008009, 0x1400c009, 0x1400c009,
+	0x41000009, 0x41000009, 0x41004009, 0x41004009, 0x41008009, 0x41008009, 0x4100c009, 0x4100c009,
+	0x04000009, 0x04000009, 0x04004009, 0x04004009, 0x40000009, 0x40000009, 0x40008009, 0x40008009,
+	0x23000009, 0x23000009, 0x23004009, 0x23004009, 0x23008009, 0x23008009, 0x2300c009, 0x2300c009,
+	0x32000009, 0x32000009, 0x32004009, 0x32004009, 0x32008009, 0x32008009, 0x3200c009, 0x3200c009,
+	0x13000008, 0x13000008, 0x13000008, 0x13000008, 0x13004008, 0x13004008, 0x13004008, 0x13004008,
+	0x13008008, 0x13008008, 0x13008008, 0x13008008, 0x1300c008, 0x1300c008, 0x1300c008, 0x1300c008,
+	0x31000008, 0x31000008, 0x31000008, 0x31000008, 0x31004008, 0x31004008, 0x31004008, 0x31004008,
+	0x31008008, 0x31008008, 0x31008008, 0x31008008, 0x3100c008, 0x3100c008, 0x3100c008, 0x3100c008,
+	0x03000008, 0x03000008, 0x03000008, 0x03000008, 0x03004008, 0x03004008, 0x03004008, 0x03004008,
+	0x30000008, 0x30000008, 0x30000008, 0x30000008, 0x30008008, 0x30008008, 0x30008008, 0x30008008,
+	0x22000008, 0x22000008, 0x22000008, 0x22000008, 0x22004008, 0x22004008, 0x22004008, 0x22004008,
+	0x22008008, 0x22008008, 0x22008008, 0x22008008, 0x2200c008, 0x2200c008, 0x2200c008, 0x2200c008,
+	0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000007, 0x12000007,
+	0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004007, 0x12004007,
+	0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008007, 0x12008007,
+	0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007, 0x1200c007,
+	0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007, 0x21000007,
+	0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007, 0x21004007,
+	0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007, 0x21008007,
+	0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007, 0x2100c007,
+	0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000007, 0x02000007,
+	0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004007, 0x02004007,
+	0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000007, 0x20000007,
+	0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008007, 0x20008007,
+	0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006,
+	0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000006, 0x11000046,
+	0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006,
+	0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004006, 0x11004046,
+	0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006,
+	0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008006, 0x11008046,
+	0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006,
+	0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c006, 0x1100c046,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005,
+	0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005, 0x01000005,
+	0x01000005, 0x01000005, 0x01010055, 0x01011055, 0x01100055, 0x01102055, 0x01000045, 0x01000045,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005,
+	0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005, 0x01004005,
+	0x01004005, 0x01004005, 0x01014055, 0x01015055, 0x01104055, 0x01106055, 0x01004045, 0x01004045,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005,
+	0x10000005, 0x10000005, 0x10010055, 0x10011055, 0x10100055, 0x10102055, 0x10000045, 0x10000045,
+	0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005,
+	0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005,
+	0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005, 0x10008005,
+	0x10008005, 0x10008005, 0x10018055, 0x10019055, 0x10108055, 0x1010a055, 0x10008045, 0x10008045,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00110064, 0x00111064, 0x00112064, 0x00113064, 0x00010054, 0x00010054, 0x00011054, 0x00011054,
+	0x00100054, 0x00100054, 0x00102054, 0x00102054, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+};
+
+CACHE_ALIGNED const unsigned int quadWideTable[2 << HUFF_WIDE_BITS] = {
+	/* table A */
+	0xb0000009, 0xb0000019, 0xb1000009, 0xb1000019, 0xb2000009, 0xb2000019, 0xb3000009, 0xb3000019,
+	0xb8000009, 0xb8000019, 0xb9000009, 0xb9000019, 0xba000009, 0xba000019, 0xbb000009, 0xbb000019,
+	0xf000000a, 0xf100000a, 0xf200000a, 0xf300000a, 0xf400000a, 0xf500000a, 0xf600000a, 0xf700000a,
+	0xf800000a, 0xf900000a, 0xfa00000a, 0xfb00000a, 0xfc00000a, 0xfd00000a, 0xfe00000a, 0xff00000a,
+	0xd0000009, 0xd0000019, 0xd1000009, 0xd1000019, 0xd4000009, 0xd4000019, 0xd5000009, 0xd5000019,
+	0xd8000009, 0xd8000019, 0xd9000009, 0xd9000019, 0xdc000009, 0xdc000019, 0xdd000009, 0xdd000019,
+	0xe0000009, 0xe0000019, 0xe2000009, 0xe2000019, 0xe4000009, 0xe4000019, 0xe6000009, 0xe6000019,
+	0xe8000009, 0xe8000019, 0xea000009, 0xea000019, 0xec000009, 0xec000019, 0xee000009, 0xee000019,
+	0x70000009, 0x70000019, 0x71000009, 0x71000019, 0x72000009, 0x72000019, 0x73000009, 0x73000019,
+	0x74000009, 0x74000019, 0x75000009, 0x75000019, 0x76000009, 0x76000019, 0x77000009, 0x77000019,
+	0x50000008, 0x50000008, 0x50000018, 0x50000018, 0x51000008, 0x51000008, 0x51000018, 0x51000018,
+	0x54000008, 0x54000008, 0x54000018, 0x54000018, 0x55000008, 0x55000008, 0x55000018, 0x55000018,
+	0x90000007, 0x90000007, 0x90000007, 0x90000007, 0x90000017, 0x90000017, 0x90000017, 0x90000017,
+	0x91000007, 0x91000007, 0x91000007, 0x91000007, 0x91000017, 0x91000017, 0x91000017, 0x91000017,
+	0x98000007, 0x98000007, 0x98000007, 0x98000007, 0x98000017, 0x98000017, 0x98000017, 0x98000017,
+	0x99000007, 0x99000007, 0x99000007, 0x99000007, 0x99000017, 0x99000017, 0x99000017, 0x99000017,
+	0x60000007, 0x60000007, 0x60000007, 0x60000007, 0x60000017, 0x60000017, 0x60000017, 0x60000017,
+	0x62000007, 0x62000007, 0x62000007, 0x62000007, 0x62000017, 0x62000017, 0x62000017, 0x62000017,
+	0x64000007, 0x64000007, 0x64000007, 0x64000007, 0x64000017, 0x64000017, 0x64000017, 0x64000017,
+	0x66000007, 0x66000007, 0x66000007, 0x66000007, 0x66000017, 0x66000017, 0x66000017, 0x66000017,
+	0x30000007, 0x30000007, 0x30000007, 0x30000007, 0x30000017, 0x30000017, 0x30000017, 0x30000017,
+	0x31000007, 0x31000007, 0x31000007, 0x31000007, 0x31000017, 0x31000017, 0x31000017, 0x31000017,
+	0x32000007, 0x32000007, 0x32000007, 0x32000007, 0x32000017, 0x32000017, 0x32000017, 0x32000017,
+	0x33000007, 0x33000007, 0x33000007, 0x33000007, 0x33000017, 0x33000017, 0x33000017, 0x33000017,
+	0xa0000007, 0xa0000007, 0xa0000007, 0xa0000007, 0xa0000017, 0xa0000017, 0xa0000017, 0xa0000017,
+	0xa2000007, 0xa2000007, 0xa2000007, 0xa2000007, 0xa2000017, 0xa2000017, 0xa2000017, 0xa2000017,
+	0xa8000007, 0xa8000007, 0xa8000007, 0xa8000007, 0xa8000017, 0xa8000017, 0xa8000017, 0xa8000017,
+	0xaa000007, 0xaa000007, 0xaa000007, 0xaa000007, 0xaa000017, 0xaa000017, 0xaa000017, 0xaa000017,
+	0xc0000007, 0xc0000007, 0xc0000007, 0xc0000007, 0xc0000017, 0xc0000017, 0xc0000017, 0xc0000017,
+	0xc4000007, 0xc4000007, 0xc4000007, 0xc4000007, 0xc4000017, 0xc4000017, 0xc4000017, 0xc4000017,
+	0xc8000007, 0xc8000007, 0xc8000007, 0xc8000007, 0xc8000017, 0xc8000017, 0xc8000017, 0xc8000017,
+	0xcc000007, 0xcc000007, 0xcc000007, 0xcc000007, 0xcc000017, 0xcc000017, 0xcc000017, 0xcc000017,
+	0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005,
+	0x20200055, 0x20220055, 0x20100055, 0x20110055, 0x20400055, 0x20440055, 0x20800055, 0x20880055,
+	0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015,
+	0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015, 0x20000015,
+	0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005,
+	0x22200055, 0x22220055, 0x22100055, 0x22110055, 0x22400055, 0x22440055, 0x22800055, 0x22880055,
+	0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015,
+	0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015, 0x22000015,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005,
+	0x10200055, 0x10220055, 0x10100055, 0x10110055, 0x10400055, 0x10440055, 0x10800055, 0x10880055,
+	0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015,
+	0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015, 0x10000015,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11200055, 0x11220055, 0x11100055, 0x11110055, 0x11400055, 0x11440055, 0x11800055, 0x11880055,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015, 0x11000015,
+	0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005,
+	0x40200055, 0x40220055, 0x40100055, 0x40110055, 0x40400055, 0x40440055, 0x40800055, 0x40880055,
+	0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015,
+	0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015, 0x40000015,
+	0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005,
+	0x44200055, 0x44220055, 0x44100055, 0x44110055, 0x44400055, 0x44440055, 0x44800055, 0x44880055,
+	0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015,
+	0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015, 0x44000015,
+	0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005,
+	0x80200055, 0x80220055, 0x80100055, 0x80110055, 0x80400055, 0x80440055, 0x80800055, 0x80880055,
+	0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015,
+	0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015, 0x80000015,
+	0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005,
+	0x88200055, 0x88220055, 0x88100055, 0x88110055, 0x88400055, 0x88440055, 0x88800055, 0x88880055,
+	0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015,
+	0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015, 0x88000015,
+	0x00b00091, 0x00b10091, 0x00b20091, 0x00b30091, 0x00b80091, 0x00b90091, 0x00ba0091, 0x00bb0091,
+	0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+	0x00d00091, 0x00d10091, 0x00d40091, 0x00d50091, 0x00d80091, 0x00d90091, 0x00dc0091, 0x00dd0091,
+	0x00e00091, 0x00e20091, 0x00e40091, 0x00e60091, 0x00e80091, 0x00ea0091, 0x00ec0091, 0x00ee0091,
+	0x00700091, 0x00710091, 0x00720091, 0x00730091, 0x00740091, 0x00750091, 0x00760091, 0x00770091,
+	0x00500081, 0x00500081, 0x00510081, 0x00510081, 0x00540081, 0x00540081, 0x00550081, 0x00550081,
+	0x00900071, 0x00900071, 0x00900071, 0x00900071, 0x00910071, 0x00910071, 0x00910071, 0x00910071,
+	0x00980071, 0x00980071, 0x00980071, 0x00980071, 0x00990071, 0x00990071, 0x00990071, 0x00990071,
+	0x00600071, 0x00600071, 0x00600071, 0x00600071, 0x00620071, 0x00620071, 0x00620071, 0x00620071,
+	0x00640071, 0x00640071, 0x00640071, 0x00640071, 0x00660071, 0x00660071, 0x00660071, 0x00660071,
+	0x00300071, 0x00300071, 0x00300071, 0x00300071, 0x00310071, 0x00310071, 0x00310071, 0x00310071,
+	0x00320071, 0x00320071, 0x00320071, 0x00320071, 0x00330071, 0x00330071, 0x00330071, 0x00330071,
+	0x00a00071, 0x00a00071, 0x00a00071, 0x00a00071, 0x00a20071, 0x00a20071, 0x00a20071, 0x00a20071,
+	0x00a80071, 0x00a80071, 0x00a80071, 0x00a80071, 0x00aa0071, 0x00aa0071, 0x00aa0071, 0x00aa0071,
+	0x00c00071, 0x00c00071, 0x00c00071, 0x00c00071, 0x00c40071, 0x00c40071, 0x00c40071, 0x00c40071,
+	0x00c80071, 0x00c80071, 0x00c80071, 0x00c80071, 0x00cc0071, 0x00cc0071, 0x00cc0071, 0x00cc0071,
+	0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051,
+	0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051, 0x00200051,
+	0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051,
+	0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051, 0x00220051,
+	0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051,
+	0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051, 0x00100051,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051, 0x00110051,
+	0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051,
+	0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051, 0x00400051,
+	0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051,
+	0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051, 0x00440051,
+	0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051,
+	0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051, 0x00800051,
+	0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051,
+	0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051, 0x00880051,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011, 0x00000011,
+	/* table B */
+	0xf0000008, 0xf0000008, 0xf0000008, 0xf0000008, 0xf1000008, 0xf1000008, 0xf1000008, 0xf1000008,
+	0xf2000008, 0xf2000008, 0xf2000008, 0xf2000008, 0xf3000008, 0xf3000008, 0xf3000008, 0xf3000008,
+	0xf4000008, 0xf4000008, 0xf4000008, 0xf4000008, 0xf5000008, 0xf5000008, 0xf5000008, 0xf5000008,
+	0xf6000008, 0xf6000008, 0xf6000008, 0xf6000008, 0xf7000008, 0xf7000008, 0xf7000008, 0xf7000008,
+	0xf8000008, 0xf8000008, 0xf8000008, 0xf8000008, 0xf9000008, 0xf9000008, 0xf9000008, 0xf9000008,
+	0xfa000008, 0xfa000008, 0xfa000008, 0xfa000008, 0xfb000008, 0xfb000008, 0xfb000008, 0xfb000008,
+	0xfc000008, 0xfc000008, 0xfc000008, 0xfc000008, 0xfd000008, 0xfd000008, 0xfd000008, 0xfd000008,
+	0xfe000008, 0xfe000008, 0xfe000008, 0xfe000008, 0xff000008, 0xff000008, 0xff000008, 0xff000008,
+	0xe0000007, 0xe0000007, 0xe0000007, 0xe0000007, 0xe0000007, 0xe0000007, 0xe0000007, 0xe0000007,
+	0xe2000007, 0xe2000007, 0xe2000007, 0xe2000007, 0xe2000007, 0xe2000007, 0xe2000007, 0xe2000007,
+	0xe4000007, 0xe4000007, 0xe4000007, 0xe4000007, 0xe4000007, 0xe4000007, 0xe4000007, 0xe4000007,
+	0xe6000007, 0xe6000007, 0xe6000007, 0xe6000007, 0xe6000007, 0xe6000007, 0xe6000007, 0xe6000007,
+	0xe8000007, 0xe8000007, 0xe8000007, 0xe8000007, 0xe8000007, 0xe8000007, 0xe8000007, 0xe8000007,
+	0xea000007, 0xea000007, 0xea000007, 0xea000007, 0xea000007, 0xea000007, 0xea000007, 0xea000007,
+	0xec000007, 0xec000007, 0xec000007, 0xec000007, 0xec000007, 0xec000007, 0xec000007, 0xec000007,
+	0xee000007, 0xee000007, 0xee000007, 0xee000007, 0xee000007, 0xee000007, 0xee000007, 0xee000007,
+	0xd0000007, 0xd0000007, 0xd0000007, 0xd0000007, 0xd0000007, 0xd0000007, 0xd0000007, 0xd0000007,
+	0xd1000007, 0xd1000007, 0xd1000007, 0xd1000007, 0xd1000007, 0xd1000007, 0xd1000007, 0xd1000007,
+	0xd4000007, 0xd4000007, 0xd4000007, 0xd4000007, 0xd4000007, 0xd4000007, 0xd4000007, 0xd4000007,
+	0xd5000007, 0xd5000007, 0xd5000007, 0xd5000007, 0xd5000007, 0xd5000007, 0xd5000007, 0xd5000007,
+	0xd8000007, 0xd8000007, 0xd8000007, 0xd8000007, 0xd8000007, 0xd8000007, 0xd8000007, 0xd8000007,
+	0xd9000007, 0xd9000007, 0xd9000007, 0xd9000007, 0xd9000007, 0xd9000007, 0xd9000007, 0xd9000007,
+	0xdc000007, 0xdc000007, 0xdc000007, 0xdc000007, 0xdc000007, 0xdc000007, 0xdc000007, 0xdc000007,
+	0xdd000007, 0xdd000007, 0xdd000007, 0xdd000007, 0xdd000007, 0xdd000007, 0xdd000007, 0xdd000007,
+	0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006,
+	0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000006, 0xc0000046,
+	0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006,
+	0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000006, 0xc4000046,
+	0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006,
+	0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000006, 0xc8000046,
+	0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006,
+	0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000006, 0xcc000046,
+	0xb0000007, 0xb0000007, 0xb0000007, 0xb0000007, 0xb0000007, 0xb0000007, 0xb0000007, 0xb0000007,
+	0xb1000007, 0xb1000007, 0xb1000007, 0xb1000007, 0xb1000007, 0xb1000007, 0xb1000007, 0xb1000007,
+	0xb2000007, 0xb2000007, 0xb2000007, 0xb2000007, 0xb2000007, 0xb2000007, 0xb2000007, 0xb2000007,
+	0xb3000007, 0xb3000007, 0xb3000007, 0xb3000007, 0xb3000007, 0xb3000007, 0xb3000007, 0xb3000007,
+	0xb8000007, 0xb8000007, 0xb8000007, 0xb8000007, 0xb8000007, 0xb8000007, 0xb8000007, 0xb8000007,
+	0xb9000007, 0xb9000007, 0xb9000007, 0xb9000007, 0xb9000007, 0xb9000007, 0xb9000007, 0xb9000007,
+	0xba000007, 0xba000007, 0xba000007, 0xba000007, 0xba000007, 0xba000007, 0xba000007, 0xba000007,
+	0xbb000007, 0xbb000007, 0xbb000007, 0xbb000007, 0xbb000007, 0xbb000007, 0xbb000007, 0xbb000007,
+	0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006,
+	0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000006, 0xa0000046,
+	0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006,
+	0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000006, 0xa2000046,
+	0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006,
+	0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000006, 0xa8000046,
+	0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006,
+	0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000006, 0xaa000046,
+	0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000006,
+	0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000006, 0x90000046,
+	0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000006,
+	0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000006, 0x91000046,
+	0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000006,
+	0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000006, 0x98000046,
+	0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000006,
+	0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000006, 0x99000046,
+	0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005,
+	0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80800055, 0x80880055,
+	0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80000005, 0x80400055, 0x80440055,
+	0x80000005, 0x80000005, 0x80200055, 0x80220055, 0x80100055, 0x80110055, 0x80000045, 0x80000045,
+	0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005,
+	0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88800055, 0x88880055,
+	0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88000005, 0x88400055, 0x88440055,
+	0x88000005, 0x88000005, 0x88200055, 0x88220055, 0x88100055, 0x88110055, 0x88000045, 0x88000045,
+	0x70000007, 0x70000007, 0x70000007, 0x70000007, 0x70000007, 0x70000007, 0x70000007, 0x70000007,
+	0x71000007, 0x71000007, 0x71000007, 0x71000007, 0x71000007, 0x71000007, 0x71000007, 0x71000007,
+	0x72000007, 0x72000007, 0x72000007, 0x72000007, 0x72000007, 0x72000007, 0x72000007, 0x72000007,
+	0x73000007, 0x73000007, 0x73000007, 0x73000007, 0x73000007, 0x73000007, 0x73000007, 0x73000007,
+	0x74000007, 0x74000007, 0x74000007, 0x74000007, 0x74000007, 0x74000007, 0x74000007, 0x74000007,
+	0x75000007, 0x75000007, 0x75000007, 0x75000007, 0x75000007, 0x75000007, 0x75000007, 0x75000007,
+	0x76000007, 0x76000007, 0x76000007, 0x76000007, 0x76000007, 0x76000007, 0x76000007, 0x76000007,
+	0x77000007, 0x77000007, 0x77000007, 0x77000007, 0x77000007, 0x77000007, 0x77000007, 0x77000007,
+	0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000006,
+	0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000006, 0x60000046,
+	0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000006,
+	0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000006, 0x62000046,
+	0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000006,
+	0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000006, 0x64000046,
+	0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000006,
+	0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000006, 0x66000046,
+	0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000006,
+	0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000006, 0x50000046,
+	0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000006,
+	0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000006, 0x51000046,
+	0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000006,
+	0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000006, 0x54000046,
+	0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000006,
+	0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000006, 0x55000046,
+	0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005,
+	0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40800055, 0x40880055,
+	0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40000005, 0x40400055, 0x40440055,
+	0x40000005, 0x40000005, 0x40200055, 0x40220055, 0x40100055, 0x40110055, 0x40000045, 0x40000045,
+	0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005,
+	0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44800055, 0x44880055,
+	0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44000005, 0x44400055, 0x44440055,
+	0x44000005, 0x44000005, 0x44200055, 0x44220055, 0x44100055, 0x44110055, 0x44000045, 0x44000045,
+	0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000006,
+	0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000006, 0x30000046,
+	0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000006,
+	0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000006, 0x31000046,
+	0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000006,
+	0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000006, 0x32000046,
+	0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000006,
+	0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000006, 0x33000046,
+	0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005,
+	0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20800055, 0x20880055,
+	0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20000005, 0x20400055, 0x20440055,
+	0x20000005, 0x20000005, 0x20200055, 0x20220055, 0x20100055, 0x20110055, 0x20000045, 0x20000045,
+	0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005,
+	0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22800055, 0x22880055,
+	0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22000005, 0x22400055, 0x22440055,
+	0x22000005, 0x22000005, 0x22200055, 0x22220055, 0x22100055, 0x22110055, 0x22000045, 0x22000045,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10800055, 0x10880055,
+	0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10000005, 0x10400055, 0x10440055,
+	0x10000005, 0x10000005, 0x10200055, 0x10220055, 0x10100055, 0x10110055, 0x10000045, 0x10000045,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11800055, 0x11880055,
+	0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11000005, 0x11400055, 0x11440055,
+	0x11000005, 0x11000005, 0x11200055, 0x11220055, 0x11100055, 0x11110055, 0x11000045, 0x11000045,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00c00064, 0x00c40064, 0x00c80064, 0x00cc0064,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00a00064, 0x00a20064, 0x00a80064, 0x00aa0064,
+	0x00900064, 0x00910064, 0x00980064, 0x00990064, 0x00800054, 0x00800054, 0x00880054, 0x00880054,
+	0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00600064, 0x00620064, 0x00640064, 0x00660064,
+	0x00500064, 0x00510064, 0x00540064, 0x00550064, 0x00400054, 0x00400054, 0x00440054, 0x00440054,
+	0x00300064, 0x00310064, 0x00320064, 0x00330064, 0x00200054, 0x00200054, 0x00220054, 0x00220054,
+	0x00100054, 0x00100054, 0x00110054, 0x00110054, 0x00000044, 0x00000044, 0x00000044, 0x00000044,
+};
+
+#define HUFF_WIDE_OFFSET_01	0
+#define HUFF_WIDE_OFFSET_02	(1*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_03	(2*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_05	(3*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_06	(4*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_07	(5*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_08	(6*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_09	(7*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_10	(8*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_11	(9*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_12	(10*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_13	(11*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_15	(12*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_16	(13*(1 << HUFF_WIDE_BITS))
+#define HUFF_WIDE_OFFSET_24	(14*(1 << HUFF_WIDE_BITS))
+
+CACHE_ALIGNED const int huffWideOffset[HUFF_PAIRTABS] = {
+	0,
+	HUFF_WIDE_OFFSET_01,
+	HUFF_WIDE_OFFSET_02,
+	HUFF_WIDE_OFFSET_03,
+	0,
+	HUFF_WIDE_OFFSET_05,
+	HUFF_WIDE_OFFSET_06,
+	HUFF_WIDE_OFFSET_07,
+	HUFF_WIDE_OFFSET_08,
+	HUFF_WIDE_OFFSET_09,
+	HUFF_WIDE_OFFSET_10,
+	HUFF_WIDE_OFFSET_11,
+	HUFF_WIDE_OFFSET_12,
+	HUFF_WIDE_OFFSET_13,
+	0,
+	HUFF_WIDE_OFFSET_15,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_16,
+	HUFF_WIDE_OFFSET_24,
+	HUFF_WIDE_OFFSET_24,
+	HUFF_WIDE_OFFSET_24,
+	HUFF_WIDE_OFFSET_24,
+	HUFF_WIDE_OFFSET_24,
+	HUFF_WIDE_OFFSET_24,
+	HUFF_WIDE_OFFSET_24,
+	HUFF_WIDE_OFFSET_24,
+};
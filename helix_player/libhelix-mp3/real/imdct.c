@@ -173,64 +173,45 @@ static void WinPrevious(int *xPrev, int *xPrevWin, int btPrev)
  * Description: do frequency inversion (odd samples of odd blocks) and rescale 
  *                if necessary (extra guard bits added before IMDCT)
  *
- * Inputs:      output vector y (18 new samples, spaced NBANDS apart)
- *              previous sample vector xPrev (9 samples)
- *              index of current block
+ * Inputs:      output buffer y (18 new samples per block, spaced NBANDS apart)
+ *              previous sample vector xPrev (9 samples per block)
+ *              number of blocks calculated by IMDCT36() and IMDCT12x3()
  *              number of extra shifts added before IMDCT (usually 0)
  *
  * Outputs:     inverted and rescaled (as necessary) outputs
  *              rescaled (as necessary) previous samples
  *
  * Return:      updated mOut (from new outputs y)
+ *
+ * Notes:       done once per granule, after all the IMDCT's, so that each row of y 
+ *                (one sample from every block) is processed in order - see 
+ *                x86/imdctsimd.c for the SIMD versions
  **************************************************************************************/
-static int FreqInvertRescale(int *y, int *xPrev, int blockIdx, int es)
+static int FreqInvertRescale(int y[BLOCK_SIZE][NBANDS], int *xPrev, int nBlocks, int es)
 {
-	int i, d, mOut;
-	int y0, y1, y2, y3, y4, y5, y6, y7, y8;
+	int i, j, d, mOut;
 
 	if (es == 0) {
-		/* fast case - frequency invert only (no rescaling) - can fuse into overlap-add for speed, if desired */
-		if (blockIdx & 0x01) {
-			y += NBANDS;
-			y0 = *y;	y += 2*NBANDS;
-			y1 = *y;	y += 2*NBANDS;
-			y2 = *y;	y += 2*NBANDS;
-			y3 = *y;	y += 2*NBANDS;
-			y4 = *y;	y += 2*NBANDS;
-			y5 = *y;	y += 2*NBANDS;
-			y6 = *y;	y += 2*NBANDS;
-			y7 = *y;	y += 2*NBANDS;
-			y8 = *y;	y += 2*NBANDS;
-
-			y -= 18*NBANDS;
-			*y = -y0;	y += 2*NBANDS;
-			*y = -y1;	y += 2*NBANDS;
-			*y = -y2;	y += 2*NBANDS;
-			*y = -y3;	y += 2*NBANDS;
-			*y = -y4;	y += 2*NBANDS;
-			*y = -y5;	y += 2*NBANDS;
-			*y = -y6;	y += 2*NBANDS;
-			*y = -y7;	y += 2*NBANDS;
-			*y = -y8;	y += 2*NBANDS;
+		/* fast case - frequency invert only (no rescaling) */
+		for (j = 1; j < BLOCK_SIZE; j += 2) {
+			for (i = 1; i < nBlocks; i += 2)
+				y[j][i] = -y[j][i];
 		}
 		return 0;
 	} else {
 		/* undo pre-IMDCT scaling, clipping if necessary */
 		mOut = 0;
-		if (blockIdx & 0x01) {
-			/* frequency invert */
-			for (i = 0; i < 18; i+=2) {
-				d = *y;		CLIP_2N(d, 31 - es);	*y = d << es;	mOut |= FASTABS(*y);	y += NBANDS;
-				d = -*y;	CLIP_2N(d, 31 - es);	*y = d << es;	mOut |= FASTABS(*y);	y += NBANDS;
-				d = *xPrev;	CLIP_2N(d, 31 - es);	*xPrev++ = d << es;
-			}
-		} else {
-			for (i = 0; i < 18; i+=2) {
-				d = *y;		CLIP_2N(d, 31 - es);	*y = d << es;	mOut |= FASTABS(*y);	y += NBANDS;
-				d = *y;		CLIP_2N(d, 31 - es);	*y = d << es;	mOut |= FASTABS(*y);	y += NBANDS;
-				d = *xPrev;	CLIP_2N(d, 31 - es);	*xPrev++ = d << es;
+		for (j = 0; j < BLOCK_SIZE; j++) {
+			for (i = 0; i < nBlocks; i++) {
+				d = y[j][i];
+				if (j & i & 0x01)
+					d = -d;		/* frequency invert */
+				CLIP_2N(d, 31 - es);	y[j][i] = d << es;	mOut |= FASTABS(y[j][i]);
 			}
 		}
+		for (i = 0; i < 9*nBlocks; i++) {
+			d = xPrev[i];	CLIP_2N(d, 31 - es);	xPrev[i] = d << es;
+		}
 		return mOut;
 	}
 }
@@ -245,16 +226,16 @@ static int FreqInvertRescale(int *y, int *xPrev, int blockIdx, int es)
  * float c4 = sin(2*u);
  */
 
-static const int c9_0 = 0x6ed9eba1;
-static const int c9_1 = 0x620dbe8b;
-static const int c9_2 = 0x163a1a7e;
-static const int c9_3 = 0x5246dd49;
-static const int c9_4 = 0x7e0e2e32;
+const int c9_0 = 0x6ed9eba1;
+const int c9_1 = 0x620dbe8b;
+const int c9_2 = 0x163a1a7e;
+const int c9_3 = 0x5246dd49;
+const int c9_4 = 0x7e0e2e32;
 
 /* format = Q31
  * cos(((0:8) + 0.5) * (pi/18)) 
  */
-static const int c18[9] = {
+CACHE_ALIGNED const int c18[9] = {
 	0x7f834ed0, 0x7ba3751d, 0x7401e4c1, 0x68d9f964, 0x5a82799a, 0x496af3e2, 0x36185aee, 0x2120fb83, 0x0b27eb5c, 
 };
 
@@ -329,7 +310,7 @@ static __inline void idct9(int *x)
  *      fastWin[2*j+1] = c(j)*(s(j) - c(j))
  * format = Q30
  */
-int fastWin36[18] = {
+CACHE_ALIGNED int fastWin36[18] = {
 	0x42aace8b, 0xc2e92724, 0x47311c28, 0xc95f619a, 0x4a868feb, 0xd0859d8c,
 	0x4c913b51, 0xd8243ea0, 0x4d413ccc, 0xe0000000, 0x4c913b51, 0xe7dbc161,
 	0x4a868feb, 0xef7a6275, 0x47311c28, 0xf6a09e67, 0x42aace8b, 0xfd16d8dd,
@@ -343,12 +324,13 @@ int fastWin36[18] = {
  * Inputs:      vector of 18 coefficients (N/2 inputs produces N outputs, by symmetry)
  *              overlap part of last IMDCT (9 samples - see output comments)
  *              window type (0,1,2,3) of current and previous block
- *              current block index (for deciding whether to do frequency inversion)
  *              number of guard bits in input vector
  *
  * Outputs:     18 output samples, after windowing and overlap-add with last frame
  *              second half of (unwindowed) 36-point IMDCT - save for next time
  *                only save 9 xPrev samples, using symmetry (see WinPrevious())
+ *              both are still scaled down by es if gb < 7, and not frequency inverted 
+ *                (see FreqInvertRescale())
  *
  * Notes:       this is Ken's hyper-fast algorithm, including symmetric sin window
  *                optimization, if applicable
@@ -368,7 +350,7 @@ int fastWin36[18] = {
  *                inline asm may or may not be helpful)
  **************************************************************************************/
 // barely faster in RAM
-static int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int blockIdx, int gb)
+static int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int gb)
 {
 	int i, es, xBuf[18], xPrevWin[18];
 	int acc1, acc2, s, d, t, mOut;
@@ -459,9 +441,6 @@ static int IMDCT36(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int b
 		}
 	}
 
-	xPrev -= 9;
-	mOut |= FreqInvertRescale(y, xPrev, blockIdx, es);
-
 	return mOut;
 }
 
@@ -525,19 +504,20 @@ static __inline void imdct12 (int *x, int *out)
  *                (block0[0], block1[0], block2[0], block0[1], block1[1]....)
  *              overlap part of last IMDCT (9 samples - see output comments)
  *              window type (0,1,2,3) of previous block
- *              current block index (for deciding whether to do frequency inversion)
  *              number of guard bits in input vector
  *
  * Outputs:     updated sample vector x, net gain of 1 integer bit
  *              second half of (unwindowed) IMDCT's - save for next time
  *                only save 9 xPrev samples, using symmetry (see WinPrevious())
+ *              both are still scaled down by es if gb < 7, and not frequency inverted 
+ *                (see FreqInvertRescale())
  *
  * Return:      mOut (OR of abs(y) for all y calculated here)
  *
  * TODO:        optimize for ARM
  **************************************************************************************/
  // barely faster in RAM
-static int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, int gb)
+static int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int gb)
 {
 	int i, es, mOut, yLo, xBuf[18], xPrevWin[18];	/* need temp buffer for reordering short blocks */
 	const int *wp;
@@ -589,12 +569,25 @@ static int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, i
 	for (i = 12; i < 18; i++)
 		*xPrev++ = xBuf[i] >> 2;
 
-	xPrev -= 9;
-	mOut |= FreqInvertRescale(y, xPrev, blockIdx, es);
-
 	return mOut;
 }
 
+/* currWinIdx picks the right window for long blocks (if mixed, long blocks use window type 0) */
+static __inline int LongWinIdx(SideInfoSub *sis, BlockCount *bc, int i)
+{
+	if (sis->mixedBlock && i < bc->currWinSwitch) 
+		return 0;
+	return sis->blockType;
+}
+
+/* window used by the previous block i */
+static __inline int PrevWinIdx(BlockCount *bc, int i)
+{
+	if (i < bc->prevWinSwitch)
+		return 0;
+	return bc->prevType;
+}
+
 /**************************************************************************************
  * Function:    HybridTransform
  *
@@ -609,41 +602,62 @@ static int IMDCT12x3(int *xCurr, int *xPrev, int *y, int btPrev, int blockIdx, i
  *                number of long blocks in input vector (rest assumed to be short blocks)
  *                number of blocks which use long window (type) 0 in case of mixed block
  *                  (bc->currWinSwitch, 0 for non-mixed blocks)
+ *                number of blocks in y which may not be zero yet (bc->nBlocksClear)
+ *              SIMD_xxx flags (runs of long blocks and FreqInvertRescale() use the x86 
+ *                SIMD versions if available)
  *
  * Outputs:     transformed, windowed, and overlapped sample buffer
  *              does frequency inversion on odd blocks
  *              updated buffer of samples for overlap
+ *              bound on the non-zero blocks in y (bc->nBlocksNonZero, 0 if all zero)
  *
  * Return:      number of non-zero IMDCT blocks calculated in this call
  *                (including overlap-add)
  *
  * TODO:        examine mixedBlock/winSwitch logic carefully (test he_mode.bit)
  **************************************************************************************/
-static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], SideInfoSub *sis, BlockCount *bc)
+static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], SideInfoSub *sis, BlockCount *bc, int simdCaps)
 {
 	int xPrevWin[18], currWinIdx, prevWinIdx;
-	int i, j, nBlocksOut, nonZero, mOut;
-	int fiBit, xp;
+	int i, j, es, nBlocksOut, nonZero, mOut;
+	int fiBit, xp, *xPrevStart;
 
 	ASSERT(bc->nBlocksLong  <= NBANDS);
 	ASSERT(bc->nBlocksTotal <= NBANDS);
 	ASSERT(bc->nBlocksPrev  <= NBANDS);
 
 	mOut = 0;
+	xPrevStart = xPrev;
 
 	/* do long blocks, if any */
 	for(i = 0; i < bc->nBlocksLong; i++) {
-		/* currWinIdx picks the right window for long blocks (if mixed, long blocks use window type 0) */
-		currWinIdx = sis->blockType;
-		if (sis->mixedBlock && i < bc->currWinSwitch) 
-			currWinIdx = 0;
+		currWinIdx = LongWinIdx(sis, bc, i);
+		prevWinIdx = PrevWinIdx(bc, i);
 
-		prevWinIdx = bc->prevType;
-		if (i < bc->prevWinSwitch)
-			 prevWinIdx = 0;
+#ifdef HELIX_X86_SIMD
+		/* do 8 or 4 blocks at once if they all use the same windows (the window index is 0 up to 
+		 *   the switch point and constant after it, so it's enough to check the last block of the run)
+		 */
+		if ((simdCaps & SIMD_AVX2) && i + 8 <= bc->nBlocksLong && 
+			currWinIdx == LongWinIdx(sis, bc, i + 7) && prevWinIdx == PrevWinIdx(bc, i + 7)) {
+			mOut |= IMDCT36xAVX2(xCurr, xPrev, &(y[0][i]), currWinIdx, prevWinIdx, bc->gbIn);
+			xCurr += 8*18;
+			xPrev += 8*9;
+			i += 7;
+			continue;
+		}
+		if ((simdCaps & SIMD_SSE41) && i + 4 <= bc->nBlocksLong && 
+			currWinIdx == LongWinIdx(sis, bc, i + 3) && prevWinIdx == PrevWinIdx(bc, i + 3)) {
+			mOut |= IMDCT36xSSE41(xCurr, xPrev, &(y[0][i]), currWinIdx, prevWinIdx, bc->gbIn);
+			xCurr += 4*18;
+			xPrev += 4*9;
+			i += 3;
+			continue;
+		}
+#endif
 
 		/* do 36-point IMDCT, including windowing and overlap-add */
-		mOut |= IMDCT36(xCurr, xPrev, &(y[0][i]), currWinIdx, prevWinIdx, i, bc->gbIn);
+		mOut |= IMDCT36(xCurr, xPrev, &(y[0][i]), currWinIdx, prevWinIdx, bc->gbIn);
 		xCurr += 18;
 		xPrev += 9;
 	}
@@ -656,11 +670,22 @@ static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], Si
 		if (i < bc->prevWinSwitch)
 			 prevWinIdx = 0;
 		
-		mOut |= IMDCT12x3(xCurr, xPrev, &(y[0][i]), prevWinIdx, i, bc->gbIn);
+		mOut |= IMDCT12x3(xCurr, xPrev, &(y[0][i]), prevWinIdx, bc->gbIn);
 		xCurr += 18;
 		xPrev += 9;
 	}
 	nBlocksOut = i;
+
+	/* frequency inversion and rescaling for all the blocks above (same es as in IMDCT36() and IMDCT12x3()) */
+	es = (bc->gbIn < 7 ? 7 - bc->gbIn : 0);
+#ifdef HELIX_X86_SIMD
+	if (simdCaps & SIMD_AVX2)
+		mOut |= FreqInvertRescaleAVX2(y, xPrevStart, nBlocksOut, es);
+	else if (simdCaps & SIMD_SSE41)
+		mOut |= FreqInvertRescaleSSE41(y, xPrevStart, nBlocksOut, es);
+	else
+#endif
+	mOut |= FreqInvertRescale(y, xPrevStart, nBlocksOut, es);
 	
 	/* window and overlap prev if prev longer that current */
 	for (   ; i < bc->nBlocksPrev; i++) {
@@ -691,8 +716,9 @@ static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], Si
 			nBlocksOut = i;
 	}
 	
-	/* clear rest of blocks */
-	for (   ; i < 32; i++) {
+	/* clear rest of blocks (above nBlocksClear they are still zero from last time) */
+	bc->nBlocksNonZero = (mOut ? i : 0);
+	for (   ; i < bc->nBlocksClear; i++) {
 		for (j = 0; j < 18; j++) 
 			y[j][i] = 0;
 	}
@@ -721,7 +747,7 @@ static int HybridTransform(int *xCurr, int *xPrev, int y[BLOCK_SIZE][NBANDS], Si
  // a bit faster in RAM
 int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
 {
-	int nBfly, blockCutoff;
+	int nBfly, blockCutoff, sbLimit;
 	FrameHeader *fh;
 	SideInfo *si;
 	HuffmanInfo *hi;
@@ -758,9 +784,26 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
 		bc.nBlocksLong = 0;
 		nBfly = 0;
 	}
+
+	/* reduced-rate output (MP3SetDecimation) only synthesizes the lowest sbLimit subbands,
+	 *   so skip everything above them (mixed block cutoff is always below sbLimit)
+	 */
+	sbLimit = NBANDS / mp3DecInfo->decimate;
+	if (bc.nBlocksLong > sbLimit) {
+		bc.nBlocksLong = sbLimit;
+		nBfly = sbLimit - 1;
+	}
  
+#ifdef HELIX_X86_SIMD
+	if (mp3DecInfo->simdCaps & SIMD_AVX2)
+		AntiAliasAVX2(hi->huffDecBuf[ch], nBfly);
+	else if (mp3DecInfo->simdCaps & SIMD_SSE41)
+		AntiAliasSSE41(hi->huffDecBuf[ch], nBfly);
+	else
+#endif
 	AntiAlias(hi->huffDecBuf[ch], nBfly);
 	hi->nonZeroBound[ch] = MAX(hi->nonZeroBound[ch], (nBfly * 18) + 8);
+	hi->nonZeroBound[ch] = MIN(hi->nonZeroBound[ch], sbLimit * 18);
 
 	ASSERT(hi->nonZeroBound[ch] <= MAX_NSAMP);
 
@@ -771,11 +814,13 @@ int IMDCT(MP3DecInfo *mp3DecInfo, int gr, int ch)
 	bc.prevWinSwitch = mi->prevWinSwitch[ch];
 	bc.currWinSwitch = (si->sis[gr][ch].mixedBlock ? blockCutoff : 0);	/* where WINDOW switches (not nec. transform) */
 	bc.gbIn = hi->gb[ch];
+	bc.nBlocksClear = mi->nBands[ch];
 
-	mi->numPrevIMDCT[ch] = HybridTransform(hi->huffDecBuf[ch], mi->overBuf[ch], mi->outBuf[ch], &si->sis[gr][ch], &bc);
+	mi->numPrevIMDCT[ch] = HybridTransform(hi->huffDecBuf[ch], mi->overBuf[ch], mi->outBuf[ch], &si->sis[gr][ch], &bc, mp3DecInfo->simdCaps);
 	mi->prevType[ch] = si->sis[gr][ch].blockType;
 	mi->prevWinSwitch[ch] = bc.currWinSwitch;		/* 0 means not a mixed block (either all short or all long) */
 	mi->gb[ch] = bc.gbOut;
+	mi->nBands[ch] = bc.nBlocksNonZero;
 
 	ASSERT(mi->numPrevIMDCT[ch] <= NBANDS);
 
@@ -0,0 +1,335 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * pipeline.c - two-stage pipelined decoding: the caller's thread does entropy decoding
+ *                and dequantization, a second thread does IMDCT + subband transform
+ *
+ * Granules are handed over in a small ring of slots (one producer, one consumer), each 
+ *  holding the dequantized coefficients plus the frame header and side info IMDCT needs.
+ *  IMDCTInfo and SubbandInfo (overlap and vbuf history) are only touched by the 
+ *  synthesis thread while the pipeline is running, so output is bit-exact with the 
+ *  serial decoder.
+ **************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "coder.h"
+
+#if !defined(_WIN32) && !defined(HELIX_NO_THREADS)
+#define HELIX_PTHREADS
+#include <pthread.h>
+#include <semaphore.h>
+#endif
+
+#define PIPE_SLOTS		4		/* granules which can be queued for synthesis (2 frames of MPEG 1) */
+
+#ifdef HELIX_PTHREADS
+
+typedef struct _GranuleSlot {
+	HuffmanInfo hi;				/* first, so the coefficient buffers stay cache-line aligned */
+	FrameHeader fh;
+	SideInfo si;
+	short *pcmBuf;
+	MP3GranuleFunc granuleFunc;
+	void *granuleUser;
+	int gr;
+	int nChans;
+	int nGranSamps;
+	int chanStride;
+	int bitsPerSample;
+	MP3ChannelMode channelMode;
+	int decimate;
+	MP3StageStats *stageStats;
+	int quit;
+} GranuleSlot;
+
+typedef struct _PipelineInfo {
+	GranuleSlot slot[PIPE_SLOTS];
+	MP3DecInfo backInfo;		/* synthesis thread's view of the decoder, *PS point into current slot */
+	void *frontHuffmanInfoPS;	/* decoder's own HuffmanInfo, restored when the pipeline drains */
+	int head;					/* next slot to synthesize (synthesis thread only) */
+	int tail;					/* next slot to fill (decoding thread only) */
+	int inFlight;				/* slots submitted and not yet reclaimed (decoding thread only) */
+	sem_t full;					/* posted once per submitted slot */
+	sem_t done;					/* posted once per synthesized slot */
+	pthread_t thread;
+	void *allocBuf;
+} PipelineInfo;
+
+/**************************************************************************************
+ * Function:    SynthesisThread
+ *
+ * Description: synthesis stage, runs IMDCT and subband transform on queued granules
+ *
+ * Inputs:      PipelineInfo struct
+ *
+ * Outputs:     PCM for each granule, written to the slot's pcmBuf
+ *
+ * Return:      0
+ **************************************************************************************/
+static void *SynthesisThread(void *arg)
+{
+	PipelineInfo *pi = (PipelineInfo *)arg;
+	MP3DecInfo *back = &pi->backInfo;
+	GranuleSlot *gs;
+	MP3Counter t0;
+	int ch;
+
+	for (;;) {
+		sem_wait(&pi->full);
+		gs = &pi->slot[pi->head];
+		if (gs->quit)
+			break;
+
+		back->FrameHeaderPS = &gs->fh;
+		back->SideInfoPS = &gs->si;
+		back->HuffmanInfoPS = &gs->hi;
+		back->nChans = gs->nChans;
+		back->chanStride = gs->chanStride;
+		back->bitsPerSample = gs->bitsPerSample;
+		back->channelMode = gs->channelMode;
+		back->nGranSamps = gs->nGranSamps;
+		back->decimate = gs->decimate;
+		back->stageStats = gs->stageStats;
+
+		/* IMDCT only fails on null pointers, which can't happen here
+		 * stage times go to the decoder's own stats, the decoding thread only updates the other stages
+		 */
+		for (ch = 0; ch < gs->nChans; ch++) {
+			if (CHANNEL_USED(back, ch)) {
+				t0 = STAGE_START(back);
+				IMDCT(back, gs->gr, ch);
+				STAGE_END(back, MP3_STAGE_IMDCT, t0);
+			}
+		}
+		t0 = STAGE_START(back);
+		Subband(back, gs->pcmBuf);
+		STAGE_END(back, MP3_STAGE_SUBBAND, t0);
+		if (gs->granuleFunc)
+			gs->granuleFunc(gs->granuleUser, gs->pcmBuf, OUT_GRAN_SAMPS(back) * OUT_CHANS(back));
+
+		pi->head = (pi->head + 1) % PIPE_SLOTS;
+		sem_post(&pi->done);
+	}
+
+	return 0;
+}
+
+/**************************************************************************************
+ * Function:    PipelineCreate
+ *
+ * Description: allocate the granule queue and start the synthesis thread
+ *
+ * Inputs:      valid MP3DecInfo struct, not pipelined yet
+ *
+ * Outputs:     mp3DecInfo->PipelinePS set
+ *
+ * Return:      0 on success, -1 if out of memory or the thread couldn't be started
+ **************************************************************************************/
+int PipelineCreate(MP3DecInfo *mp3DecInfo)
+{
+	PipelineInfo *pi;
+	void *allocBuf;
+
+	/* over-allocate so the slots can start on a cache line */
+	allocBuf = malloc(sizeof(PipelineInfo) + 63);
+	if (!allocBuf)
+		return -1;
+	pi = (PipelineInfo *)(((size_t)allocBuf + 63) & ~(size_t)63);
+	memset(pi, 0, sizeof(PipelineInfo));
+	pi->allocBuf = allocBuf;
+
+	pi->backInfo.IMDCTInfoPS = mp3DecInfo->IMDCTInfoPS;
+	pi->backInfo.SubbandInfoPS = mp3DecInfo->SubbandInfoPS;
+	pi->backInfo.simdCaps = mp3DecInfo->simdCaps;
+	pi->frontHuffmanInfoPS = mp3DecInfo->HuffmanInfoPS;
+
+	if (sem_init(&pi->full, 0, 0) < 0) {
+		free(allocBuf);
+		return -1;
+	}
+	if (sem_init(&pi->done, 0, 0) < 0) {
+		sem_destroy(&pi->full);
+		free(allocBuf);
+		return -1;
+	}
+	if (pthread_create(&pi->thread, 0, SynthesisThread, pi) != 0) {
+		sem_destroy(&pi->done);
+		sem_destroy(&pi->full);
+		free(allocBuf);
+		return -1;
+	}
+
+	mp3DecInfo->PipelinePS = pi;
+	return 0;
+}
+
+/**************************************************************************************
+ * Function:    PipelineFlush
+ *
+ * Description: wait until every queued granule has been synthesized
+ *
+ * Inputs:      pipelined MP3DecInfo struct
+ *
+ * Outputs:     PCM for all submitted granules written, decoder's own HuffmanInfo restored
+ *
+ * Return:      none
+ **************************************************************************************/
+void PipelineFlush(MP3DecInfo *mp3DecInfo)
+{
+	PipelineInfo *pi = (PipelineInfo *)mp3DecInfo->PipelinePS;
+
+	if (!pi)
+		return;
+
+	while (pi->inFlight > 0) {
+		sem_wait(&pi->done);
+		pi->inFlight--;
+	}
+	mp3DecInfo->HuffmanInfoPS = pi->frontHuffmanInfoPS;
+}
+
+/**************************************************************************************
+ * Function:    PipelineBeginGranule
+ *
+ * Description: get a free slot for the next granule
+ *
+ * Inputs:      pipelined MP3DecInfo struct
+ *
+ * Outputs:     mp3DecInfo->HuffmanInfoPS points to the slot, so DecodeHuffman and 
+ *                Dequantize write straight into it
+ *
+ * Return:      none
+ *
+ * Notes:       blocks only if all PIPE_SLOTS slots are waiting for synthesis
+ **************************************************************************************/
+void PipelineBeginGranule(MP3DecInfo *mp3DecInfo)
+{
+	PipelineInfo *pi = (PipelineInfo *)mp3DecInfo->PipelinePS;
+
+	if (pi->inFlight == PIPE_SLOTS) {
+		sem_wait(&pi->done);
+		pi->inFlight--;
+	}
+	mp3DecInfo->HuffmanInfoPS = &pi->slot[pi->tail].hi;
+}
+
+/**************************************************************************************
+ * Function:    PipelineSubmitGranule
+ *
+ * Description: queue the current slot for IMDCT + subband transform
+ *
+ * Inputs:      pipelined MP3DecInfo struct, after Dequantize() into the slot from 
+ *                PipelineBeginGranule()
+ *              index of current granule
+ *              output buffer for this granule's PCM
+ *
+ * Outputs:     none
+ *
+ * Return:      none
+ **************************************************************************************/
+void PipelineSubmitGranule(MP3DecInfo *mp3DecInfo, int gr, short *pcmBuf)
+{
+	PipelineInfo *pi = (PipelineInfo *)mp3DecInfo->PipelinePS;
+	GranuleSlot *gs = &pi->slot[pi->tail];
+
+	gs->fh = *(FrameHeader *)mp3DecInfo->FrameHeaderPS;
+	gs->si = *(SideInfo *)mp3DecInfo->SideInfoPS;
+	gs->gr = gr;
+	gs->nChans = mp3DecInfo->nChans;
+	gs->nGranSamps = mp3DecInfo->nGranSamps;
+	gs->chanStride = mp3DecInfo->chanStride;
+	gs->bitsPerSample = mp3DecInfo->bitsPerSample;
+	gs->channelMode = mp3DecInfo->channelMode;
+	gs->decimate = mp3DecInfo->decimate;
+	gs->stageStats = mp3DecInfo->stageStats;
+	gs->pcmBuf = pcmBuf;
+	gs->granuleFunc = mp3DecInfo->granuleFunc;
+	gs->granuleUser = mp3DecInfo->granuleUser;
+
+	pi->tail = (pi->tail + 1) % PIPE_SLOTS;
+	pi->inFlight++;
+	sem_post(&pi->full);
+}
+
+/**************************************************************************************
+ * Function:    PipelineDestroy
+ *
+ * Description: drain the queue, stop the synthesis thread and free the pipeline
+ *
+ * Inputs:      MP3DecInfo struct (pipelined or not)
+ *
+ * Outputs:     mp3DecInfo->PipelinePS = 0
+ *
+ * Return:      none
+ **************************************************************************************/
+void PipelineDestroy(MP3DecInfo *mp3DecInfo)
+{
+	PipelineInfo *pi = (PipelineInfo *)mp3DecInfo->PipelinePS;
+
+	if (!pi)
+		return;
+
+	PipelineFlush(mp3DecInfo);
+
+	/* all slots are free now, so the thread's next slot is the one at tail */
+	pi->slot[pi->tail].quit = 1;
+	sem_post(&pi->full);
+	pthread_join(pi->thread, 0);
+
+	sem_destroy(&pi->done);
+	sem_destroy(&pi->full);
+	free(pi->allocBuf);
+	mp3DecInfo->PipelinePS = 0;
+}
+
+#else	/* HELIX_PTHREADS */
+
+/* no threads - MP3SetPipelined() fails and the decoder stays serial */
+int PipelineCreate(MP3DecInfo *mp3DecInfo)
+{
+	return -1;
+}
+
+void PipelineDestroy(MP3DecInfo *mp3DecInfo) {}
+void PipelineBeginGranule(MP3DecInfo *mp3DecInfo) {}
+void PipelineSubmitGranule(MP3DecInfo *mp3DecInfo, int gr, short *pcmBuf) {}
+void PipelineFlush(MP3DecInfo *mp3DecInfo) {}
+
+#endif	/* HELIX_PTHREADS */
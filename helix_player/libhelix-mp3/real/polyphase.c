@@ -293,3 +293,367 @@ void PolyphaseStereo(short *pcm, int *vbuf, const int *coefBase)
 		pcm += 2;
 	}
 }
+
+/**************************************************************************************
+ * Function:    PolyphaseMonoDec
+ *
+ * Description: filter one subband and produce every step'th of the 32 output PCM 
+ *                samples for one channel
+ *
+ * Inputs:      pointer to PCM output buffer
+ *              pointer to start of vbuf (preserved from last call)
+ *              start of filter coefficient table (in proper, shuffled order)
+ *              output decimation (2 or 4, compile-time constant after inlining)
+ *
+ * Outputs:     32/step samples of one channel of decoded PCM data, (i.e. Q16.0)
+ *
+ * Return:      none
+ *
+ * Notes:       output sample k is computed exactly as in PolyphaseMono, the others are
+ *                skipped - only valid as a decimator when the upper subbands are zero
+ *                (see IMDCT), since the subband filters themselves band-limit the output
+ **************************************************************************************/
+static __inline void PolyphaseMonoDec(short *pcm, int *vbuf, const int *coefBase, int step)
+{	
+	int k;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, rndVal;
+
+	rndVal = (Word64)( 1 << (DEF_NFRACBITS - 1 + (32 - CSHIFT)) );
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = rndVal;
+
+	MC0M(0)
+	MC0M(1)
+	MC0M(2)
+	MC0M(3)
+	MC0M(4)
+	MC0M(5)
+	MC0M(6)
+	MC0M(7)
+
+	*(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + 64*16;
+	sum1L = rndVal;
+
+	MC1M(0)
+	MC1M(1)
+	MC1M(2)
+	MC1M(3)
+	MC1M(4)
+	MC1M(5)
+	MC1M(6)
+	MC1M(7)
+
+	*(pcm + 16/step) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* main convolution loop: sum1L = samples k = step, 2*step, ... 15   sum2L = samples 32-k */
+	for (k = step; k < 16; k += step) {
+		coef = coefBase + 16*k;
+		vb1 = vbuf + 64*k;
+		sum1L = sum2L = rndVal;
+
+		MC2M(0)
+		MC2M(1)
+		MC2M(2)
+		MC2M(3)
+		MC2M(4)
+		MC2M(5)
+		MC2M(6)
+		MC2M(7)
+
+		*(pcm + k/step)      = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + (32-k)/step) = ClipToShort((int)SAR64(sum2L, (32-CSHIFT)), DEF_NFRACBITS);
+	}
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseStereoDec
+ *
+ * Description: filter one subband and produce every step'th of the 32 output PCM 
+ *                samples for each channel
+ *
+ * Inputs:      see PolyphaseMonoDec
+ *
+ * Outputs:     32/step samples of two channels of decoded PCM data, (i.e. Q16.0)
+ *
+ * Return:      none
+ *
+ * Notes:       interleaves PCM samples LRLRLR...
+ **************************************************************************************/
+static __inline void PolyphaseStereoDec(short *pcm, int *vbuf, const int *coefBase, int step)
+{
+	int k;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, sum1R, sum2R, rndVal;
+
+	rndVal = (Word64)( 1 << (DEF_NFRACBITS - 1 + (32 - CSHIFT)) );
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = sum1R = rndVal;
+
+	MC0S(0)
+	MC0S(1)
+	MC0S(2)
+	MC0S(3)
+	MC0S(4)
+	MC0S(5)
+	MC0S(6)
+	MC0S(7)
+
+	*(pcm + 0) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+	*(pcm + 1) = ClipToShort((int)SAR64(sum1R, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + 64*16;
+	sum1L = sum1R = rndVal;
+
+	MC1S(0)
+	MC1S(1)
+	MC1S(2)
+	MC1S(3)
+	MC1S(4)
+	MC1S(5)
+	MC1S(6)
+	MC1S(7)
+
+	*(pcm + 2*(16/step) + 0) = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+	*(pcm + 2*(16/step) + 1) = ClipToShort((int)SAR64(sum1R, (32-CSHIFT)), DEF_NFRACBITS);
+
+	/* main convolution loop: sum1L = samples k = step, 2*step, ... 15   sum2L = samples 32-k */
+	for (k = step; k < 16; k += step) {
+		coef = coefBase + 16*k;
+		vb1 = vbuf + 64*k;
+		sum1L = sum2L = rndVal;
+		sum1R = sum2R = rndVal;
+
+		MC2S(0)
+		MC2S(1)
+		MC2S(2)
+		MC2S(3)
+		MC2S(4)
+		MC2S(5)
+		MC2S(6)
+		MC2S(7)
+
+		*(pcm + 2*(k/step) + 0)      = ClipToShort((int)SAR64(sum1L, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + 2*(k/step) + 1)      = ClipToShort((int)SAR64(sum1R, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + 2*((32-k)/step) + 0) = ClipToShort((int)SAR64(sum2L, (32-CSHIFT)), DEF_NFRACBITS);
+		*(pcm + 2*((32-k)/step) + 1) = ClipToShort((int)SAR64(sum2R, (32-CSHIFT)), DEF_NFRACBITS);
+	}
+}
+
+/* half and quarter rate kernels, same signature as PolyphaseMono/PolyphaseStereo */
+void PolyphaseMonoHalf(short *pcm, int *vbuf, const int *coefBase)
+{
+	PolyphaseMonoDec(pcm, vbuf, coefBase, 2);
+}
+
+void PolyphaseMonoQuarter(short *pcm, int *vbuf, const int *coefBase)
+{
+	PolyphaseMonoDec(pcm, vbuf, coefBase, 4);
+}
+
+void PolyphaseStereoHalf(short *pcm, int *vbuf, const int *coefBase)
+{
+	PolyphaseStereoDec(pcm, vbuf, coefBase, 2);
+}
+
+void PolyphaseStereoQuarter(short *pcm, int *vbuf, const int *coefBase)
+{
+	PolyphaseStereoDec(pcm, vbuf, coefBase, 4);
+}
+
+/* 32-bit containers: keep (outBits - 16) more bits of the 64-bit sums instead of clipping to 16 */
+#define WIDE_SHIFT(outBits)	(DEF_NFRACBITS + (32 - CSHIFT) - ((outBits) - 16))
+
+static __inline int ClipToBits(Word64 x, int shift, int outBits)
+{
+	Word64 maxVal = ((Word64)1 << (outBits - 1)) - 1;
+
+	/* assumes you've already rounded (x += (1 << (shift-1))) */
+	x = SAR64(x, shift);
+	if (x > maxVal)
+		x = maxVal;
+	else if (x < -maxVal - 1)
+		x = -maxVal - 1;
+
+	return (int)x;
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseMono32
+ *
+ * Description: filter one subband and produce 32 output PCM samples for one channel,
+ *                without narrowing to 16 bits
+ *
+ * Inputs:      pointer to PCM output buffer
+ *              pointer to start of vbuf (preserved from last call)
+ *              start of filter coefficient table (in proper, shuffled order)
+ *              number of output bits (24 or 32, right-justified in 32-bit ints)
+ *              output decimation (1 for all 32 samples, 2 or 4 - see PolyphaseMonoDec)
+ *
+ * Outputs:     32/step samples of one channel of decoded PCM data, Q(outBits-1) full scale
+ *
+ * Return:      none
+ *
+ * Notes:       same filter as PolyphaseMono, the top 16 bits of 32-bit output are the
+ *                16-bit result (modulo rounding)
+ **************************************************************************************/
+void PolyphaseMono32(int *pcm, int *vbuf, const int *coefBase, int outBits, int step)
+{	
+	int k, shift;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, rndVal;
+
+	shift = WIDE_SHIFT(outBits);
+	rndVal = (Word64)1 << (shift - 1);
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = rndVal;
+
+	MC0M(0)
+	MC0M(1)
+	MC0M(2)
+	MC0M(3)
+	MC0M(4)
+	MC0M(5)
+	MC0M(6)
+	MC0M(7)
+
+	*(pcm + 0) = ClipToBits(sum1L, shift, outBits);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + 64*16;
+	sum1L = rndVal;
+
+	MC1M(0)
+	MC1M(1)
+	MC1M(2)
+	MC1M(3)
+	MC1M(4)
+	MC1M(5)
+	MC1M(6)
+	MC1M(7)
+
+	*(pcm + 16/step) = ClipToBits(sum1L, shift, outBits);
+
+	/* main convolution loop: sum1L = samples k = step, 2*step, ... 15   sum2L = samples 32-k */
+	for (k = step; k < 16; k += step) {
+		coef = coefBase + 16*k;
+		vb1 = vbuf + 64*k;
+		sum1L = sum2L = rndVal;
+
+		MC2M(0)
+		MC2M(1)
+		MC2M(2)
+		MC2M(3)
+		MC2M(4)
+		MC2M(5)
+		MC2M(6)
+		MC2M(7)
+
+		*(pcm + k/step)      = ClipToBits(sum1L, shift, outBits);
+		*(pcm + (32-k)/step) = ClipToBits(sum2L, shift, outBits);
+	}
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseStereo32
+ *
+ * Description: filter one subband and produce 32 output PCM samples for each channel,
+ *                without narrowing to 16 bits
+ *
+ * Inputs:      see PolyphaseMono32
+ *
+ * Outputs:     32/step samples of two channels of decoded PCM data, Q(outBits-1) full scale
+ *
+ * Return:      none
+ *
+ * Notes:       interleaves PCM samples LRLRLR...
+ **************************************************************************************/
+void PolyphaseStereo32(int *pcm, int *vbuf, const int *coefBase, int outBits, int step)
+{
+	int k, shift;
+	const int *coef;
+	int *vb1;
+	int vLo, vHi, c1, c2;
+	Word64 sum1L, sum2L, sum1R, sum2R, rndVal;
+
+	shift = WIDE_SHIFT(outBits);
+	rndVal = (Word64)1 << (shift - 1);
+
+	/* special case, output sample 0 */
+	coef = coefBase;
+	vb1 = vbuf;
+	sum1L = sum1R = rndVal;
+
+	MC0S(0)
+	MC0S(1)
+	MC0S(2)
+	MC0S(3)
+	MC0S(4)
+	MC0S(5)
+	MC0S(6)
+	MC0S(7)
+
+	*(pcm + 0) = ClipToBits(sum1L, shift, outBits);
+	*(pcm + 1) = ClipToBits(sum1R, shift, outBits);
+
+	/* special case, output sample 16 */
+	coef = coefBase + 256;
+	vb1 = vbuf + 64*16;
+	sum1L = sum1R = rndVal;
+
+	MC1S(0)
+	MC1S(1)
+	MC1S(2)
+	MC1S(3)
+	MC1S(4)
+	MC1S(5)
+	MC1S(6)
+	MC1S(7)
+
+	*(pcm + 2*(16/step) + 0) = ClipToBits(sum1L, shift, outBits);
+	*(pcm + 2*(16/step) + 1) = ClipToBits(sum1R, shift, outBits);
+
+	/* main convolution loop: sum1L = samples k = step, 2*step, ... 15   sum2L = samples 32-k */
+	for (k = step; k < 16; k += step) {
+		coef = coefBase + 16*k;
+		vb1 = vbuf + 64*k;
+		sum1L = sum2L = rndVal;
+		sum1R = sum2R = rndVal;
+
+		MC2S(0)
+		MC2S(1)
+		MC2S(2)
+		MC2S(3)
+		MC2S(4)
+		MC2S(5)
+		MC2S(6)
+		MC2S(7)
+
+		*(pcm + 2*(k/step) + 0)      = ClipToBits(sum1L, shift, outBits);
+		*(pcm + 2*(k/step) + 1)      = ClipToBits(sum1R, shift, outBits);
+		*(pcm + 2*((32-k)/step) + 0) = ClipToBits(sum2L, shift, outBits);
+		*(pcm + 2*((32-k)/step) + 1) = ClipToBits(sum2R, shift, outBits);
+	}
+}
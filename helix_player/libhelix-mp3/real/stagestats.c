@@ -0,0 +1,94 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * stagestats.c - time source for the per-stage counters (MP3SetStageStats)
+ **************************************************************************************/
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#define HELIX_CLOCK_GETTIME
+/* clock_gettime() is POSIX, not ISO C - must be requested before any system header (e.g. -std=c11) */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+#include <time.h>
+#else
+#include <time.h>
+#endif
+
+#include "coder.h"
+
+/**************************************************************************************
+ * Function:    GetStageClock
+ *
+ * Description: read a monotonic clock
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      current time in nanoseconds, from an arbitrary starting point
+ *
+ * Notes:       only called when stage statistics are enabled
+ *              vDSO clock_gettime() on Linux costs a few tens of ns, the fallback 
+ *                clock() has much coarser resolution
+ **************************************************************************************/
+MP3Counter GetStageClock(void)
+{
+#if defined(_WIN32)
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER now;
+
+	if (!freq.QuadPart)
+		QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+
+	return (MP3Counter)(now.QuadPart / freq.QuadPart) * 1000000000 + 
+		(MP3Counter)(now.QuadPart % freq.QuadPart) * 1000000000 / freq.QuadPart;
+#elif defined(HELIX_CLOCK_GETTIME)
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (MP3Counter)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+	return (MP3Counter)clock() * (1000000000 / CLOCKS_PER_SEC);
+#endif
+}
@@ -0,0 +1,299 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * state.c - save and restore the decoder state which carries over between frames
+ *             (MP3SaveState, MP3RestoreState)
+ *
+ * Only a few things outlive a frame: the bit reservoir, the IMDCT overlap and the 
+ *  polyphase filter history, plus the granule 0 long-block scalefactors (granule 1 
+ *  copies them with scfsi even when this frame's granule 0 was all short blocks). 
+ *  The blob holds just the live parts of each:
+ *  - the last MAINDATA_BEGIN_MAX bytes of main data (all a later frame can reference)
+ *  - numPrevIMDCT blocks of overlap per channel (the rest of overBuf is always zero)
+ *  - half of each vbuf row, since FDCT32 stores every value twice (d[0] = d[8])
+ * Ints are stored in native byte order, so a blob is only valid for the same build.
+ **************************************************************************************/
+
+#include <string.h>
+#include "coder.h"
+
+#define STATE_MAGIC			0x484d5301	/* "HMS", format version 1 */
+#define STATE_HDR_INTS		7
+#define STATE_CHAN_INTS		3
+#define VBUF_ROWS			(MAX_NCHAN * VBUF_LENGTH / 64)	/* rows of 64: 32 samples per channel */
+#define VBUF_SAVE_INTS		(VBUF_ROWS * 16)				/* per channel, duplicates dropped */
+#define SF_SAVE_BYTES		((int)sizeof(((ScaleFactorInfoSub *)0)->l))
+
+/**************************************************************************************
+ * Function:    GetStateSize
+ *
+ * Description: largest possible state blob
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      size in bytes
+ **************************************************************************************/
+int GetStateSize(void)
+{
+	return (STATE_HDR_INTS + MAX_NCHAN * (STATE_CHAN_INTS + NBANDS * 9 + VBUF_SAVE_INTS)) * sizeof(int) + 
+		MAX_NCHAN * SF_SAVE_BYTES + MAINDATA_BEGIN_MAX;
+}
+
+/**************************************************************************************
+ * Function:    ChannelIdle
+ *
+ * Description: check whether a channel carries no state into the next frame
+ *
+ * Inputs:      IMDCTInfo, SubbandInfo and ScaleFactorInfo structs
+ *              channel index
+ *
+ * Outputs:     none
+ *
+ * Return:      1 if overlap, filterbank history and saved scalefactors are all zero, 
+ *                0 otherwise
+ *
+ * Notes:       a second channel stays live for a while after a stream switches from 
+ *                stereo to mono
+ **************************************************************************************/
+static int ChannelIdle(IMDCTInfo *mi, SubbandInfo *sbi, ScaleFactorInfo *sfi, int ch)
+{
+	int i, row, *vb;
+
+	if (mi->numPrevIMDCT[ch] > 0)
+		return 0;
+
+	vb = sbi->vbuf + ch * 32;
+	for (row = 0; row < VBUF_ROWS; row++) {
+		for (i = 0; i < 8; i++) {
+			if (vb[i] | vb[16 + i])
+				return 0;
+		}
+		vb += 64;
+	}
+
+	for (i = 0; i < SF_SAVE_BYTES; i++) {
+		if (sfi->sfis[0][ch].l[i])
+			return 0;
+	}
+
+	return 1;
+}
+
+/**************************************************************************************
+ * Function:    SaveState
+ *
+ * Description: serialize the inter-frame state of the decoder
+ *
+ * Inputs:      MP3DecInfo structure, between frames
+ *              output buffer and its size in bytes
+ *
+ * Outputs:     state blob in buf
+ *
+ * Return:      number of bytes written, -1 if buf is too small
+ *
+ * Notes:       idle channels beyond those of the last frame are left out
+ **************************************************************************************/
+int SaveState(MP3DecInfo *mp3DecInfo, unsigned char *buf, int nBytes)
+{
+	int ch, row, nChans, nMain, nOver, size, hdr[STATE_HDR_INTS];
+	int *vb;
+	unsigned char *p;
+	IMDCTInfo *mi;
+	SubbandInfo *sbi;
+	ScaleFactorInfo *sfi;
+
+	mi = (IMDCTInfo *)mp3DecInfo->IMDCTInfoPS;
+	sbi = (SubbandInfo *)mp3DecInfo->SubbandInfoPS;
+	sfi = (ScaleFactorInfo *)mp3DecInfo->ScaleFactorInfoPS;
+
+	/* channels beyond the current stream's are only saved if they are still live */
+	nChans = MAX_NCHAN;
+	while (nChans > 1 && nChans > mp3DecInfo->nChans && ChannelIdle(mi, sbi, sfi, nChans - 1))
+		nChans--;
+	nMain = MIN(mp3DecInfo->mainDataBytes, MAINDATA_BEGIN_MAX);
+	nOver = 0;
+	for (ch = 0; ch < nChans; ch++)
+		nOver += mi->numPrevIMDCT[ch] * 9;
+
+	size = (STATE_HDR_INTS + nChans * (STATE_CHAN_INTS + VBUF_SAVE_INTS) + nOver) * sizeof(int) + 
+		nChans * SF_SAVE_BYTES + nMain;
+	if (size > nBytes)
+		return -1;
+
+	hdr[0] = STATE_MAGIC;
+	hdr[1] = size;
+	hdr[2] = nChans;
+	hdr[3] = nMain;
+	hdr[4] = mp3DecInfo->freeBitrateFlag;
+	hdr[5] = mp3DecInfo->freeBitrateSlots;
+	hdr[6] = sbi->vindex;
+	p = buf;
+	memcpy(p, hdr, sizeof(hdr));
+	p += sizeof(hdr);
+
+	for (ch = 0; ch < nChans; ch++) {
+		hdr[0] = mi->numPrevIMDCT[ch];
+		hdr[1] = mi->prevType[ch];
+		hdr[2] = mi->prevWinSwitch[ch];
+		memcpy(p, hdr, STATE_CHAN_INTS * sizeof(int));
+		p += STATE_CHAN_INTS * sizeof(int);
+
+		memcpy(p, mi->overBuf[ch], mi->numPrevIMDCT[ch] * 9 * sizeof(int));
+		p += mi->numPrevIMDCT[ch] * 9 * sizeof(int);
+
+		/* each row holds this channel's samples at [0,7] and [16,23], copied to [8,15] and [24,31] */
+		vb = sbi->vbuf + ch * 32;
+		for (row = 0; row < VBUF_ROWS; row++) {
+			memcpy(p, vb + 0,  8 * sizeof(int));	p += 8 * sizeof(int);
+			memcpy(p, vb + 16, 8 * sizeof(int));	p += 8 * sizeof(int);
+			vb += 64;
+		}
+
+		memcpy(p, sfi->sfis[0][ch].l, SF_SAVE_BYTES);
+		p += SF_SAVE_BYTES;
+	}
+
+	memcpy(p, mp3DecInfo->mainBuf + mp3DecInfo->mainDataStart + mp3DecInfo->mainDataBytes - nMain, nMain);
+
+	return size;
+}
+
+/**************************************************************************************
+ * Function:    RestoreState
+ *
+ * Description: load a state blob written by SaveState
+ *
+ * Inputs:      MP3DecInfo structure, between frames
+ *              state blob and its size in bytes
+ *
+ * Outputs:     bit reservoir, overlap and filterbank history replaced
+ *
+ * Return:      0 on success, -1 if the blob is not valid (decoder is unchanged)
+ **************************************************************************************/
+int RestoreState(MP3DecInfo *mp3DecInfo, const unsigned char *buf, int nBytes)
+{
+	int ch, row, nChans, nMain, nOver, hdr[STATE_HDR_INTS], chHdr[MAX_NCHAN][STATE_CHAN_INTS];
+	int *vb;
+	const unsigned char *p;
+	IMDCTInfo *mi;
+	SubbandInfo *sbi;
+	ScaleFactorInfo *sfi;
+
+	mi = (IMDCTInfo *)mp3DecInfo->IMDCTInfoPS;
+	sbi = (SubbandInfo *)mp3DecInfo->SubbandInfoPS;
+	sfi = (ScaleFactorInfo *)mp3DecInfo->ScaleFactorInfoPS;
+
+	/* validate everything before touching the decoder */
+	if (nBytes < (int)sizeof(hdr))
+		return -1;
+	memcpy(hdr, buf, sizeof(hdr));
+	nChans = hdr[2];
+	nMain = hdr[3];
+	if (hdr[0] != STATE_MAGIC || hdr[1] != nBytes || nChans < 1 || nChans > MAX_NCHAN || 
+		nMain < 0 || nMain > MAINDATA_BEGIN_MAX || (hdr[4] != 0 && hdr[4] != 1) ||
+		hdr[6] < 0 || hdr[6] > 7)
+		return -1;
+
+	/* free format frame size becomes nSlots on the next frame, so it must fit the main data window */
+	if (hdr[5] < 0 || hdr[5] > MAINBUF_WINDOW - MAINDATA_BEGIN_MAX || (hdr[4] == 0 && hdr[5] != 0))
+		return -1;
+
+	p = buf + sizeof(hdr);
+	nOver = 0;
+	for (ch = 0; ch < nChans; ch++) {
+		if (p + (STATE_CHAN_INTS + VBUF_SAVE_INTS) * sizeof(int) + SF_SAVE_BYTES > buf + nBytes)
+			return -1;
+		memcpy(chHdr[ch], p, STATE_CHAN_INTS * sizeof(int));
+		if (chHdr[ch][0] < 0 || chHdr[ch][0] > NBANDS || chHdr[ch][1] < 0 || chHdr[ch][1] > 3 ||
+			chHdr[ch][2] < 0 || chHdr[ch][2] > NBANDS)
+			return -1;
+		nOver += chHdr[ch][0] * 9;
+		p += (STATE_CHAN_INTS + chHdr[ch][0] * 9 + VBUF_SAVE_INTS) * sizeof(int) + SF_SAVE_BYTES;
+	}
+	if ((STATE_HDR_INTS + nChans * (STATE_CHAN_INTS + VBUF_SAVE_INTS) + nOver) * (int)sizeof(int) + 
+		nChans * SF_SAVE_BYTES + nMain != nBytes)
+		return -1;
+
+	mp3DecInfo->freeBitrateFlag = hdr[4];
+	mp3DecInfo->freeBitrateSlots = hdr[5];
+	sbi->vindex = hdr[6];
+
+	/* channels not in the blob were idle when it was saved */
+	memset(mi->overBuf, 0, sizeof(mi->overBuf));
+	memset(sbi->vbuf, 0, sizeof(sbi->vbuf));
+	for (ch = 0; ch < MAX_NCHAN; ch++) {
+		mi->numPrevIMDCT[ch] = 0;
+		mi->prevType[ch] = 0;
+		mi->prevWinSwitch[ch] = 0;
+		mi->nBands[ch] = NBANDS;	/* outBuf contents unknown, IMDCT clears it */
+		sbi->vbufZero[ch] = 0;
+		memset(sfi->sfis[0][ch].l, 0, SF_SAVE_BYTES);
+	}
+
+	p = buf + sizeof(hdr);
+	for (ch = 0; ch < nChans; ch++) {
+		mi->numPrevIMDCT[ch] = chHdr[ch][0];
+		mi->prevType[ch] = chHdr[ch][1];
+		mi->prevWinSwitch[ch] = chHdr[ch][2];
+		p += STATE_CHAN_INTS * sizeof(int);
+
+		memcpy(mi->overBuf[ch], p, mi->numPrevIMDCT[ch] * 9 * sizeof(int));
+		p += mi->numPrevIMDCT[ch] * 9 * sizeof(int);
+
+		vb = sbi->vbuf + ch * 32;
+		for (row = 0; row < VBUF_ROWS; row++) {
+			memcpy(vb + 0,  p, 8 * sizeof(int));	p += 8 * sizeof(int);
+			memcpy(vb + 16, p, 8 * sizeof(int));	p += 8 * sizeof(int);
+			memcpy(vb + 8,  vb + 0,  8 * sizeof(int));
+			memcpy(vb + 24, vb + 16, 8 * sizeof(int));
+			vb += 64;
+		}
+
+		memcpy(sfi->sfis[0][ch].l, p, SF_SAVE_BYTES);
+		p += SF_SAVE_BYTES;
+	}
+
+	memcpy(mp3DecInfo->mainBuf, p, nMain);
+	mp3DecInfo->mainDataStart = 0;
+	mp3DecInfo->mainDataBytes = nMain;
+
+	return 0;
+}
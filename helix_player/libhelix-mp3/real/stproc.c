@@ -44,6 +44,8 @@
 #include "coder.h"
 #include "assembly.h"
 
+typedef void (*IntensityRunFunc)(int *x0, int *x1, int nSamps, const int fl[3], const int fr[3], int mOut[2]);
+
 /**************************************************************************************
  * Function:    MidSideProc
  *
@@ -60,6 +62,7 @@
  * Return:      none
  *
  * Notes:       assume at least 1 GB in input
+ *              reference for the SIMD versions in x86/stsimd.c
  **************************************************************************************/
 void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2])  
 {
@@ -81,6 +84,40 @@ void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2])
 	mOut[1] |= mOutR;
 }
 
+/**************************************************************************************
+ * Function:    IntensityRun
+ *
+ * Description: intensity stereo for a run of samples - left channel scaled into 
+ *                left and right
+ *
+ * Inputs:      pointers to the first left and right sample
+ *              number of samples
+ *              left and right scale factors for samples 0, 1, 2, repeating 
+ *                (all 3 the same for long blocks, one per window for MPEG1 short blocks)
+ *              guard bit mask (left and right channels)
+ *
+ * Outputs:     updated samples
+ *              updated guard bit mask
+ *
+ * Return:      none
+ *
+ * Notes:       reference for the SIMD versions in x86/stsimd.c
+ **************************************************************************************/
+static void IntensityRun(int *x0, int *x1, int nSamps, const int fl[3], const int fr[3], int mOut[2])
+{
+	int i, w, xl, xr, mOutL, mOutR;
+
+	mOutL = mOutR = 0;
+	for (i = w = 0; i < nSamps; i++) {
+		xr = MULSHIFT32(fr[w], x0[i]) << 2;	x1[i] = xr;	mOutR |= FASTABS(xr);
+		xl = MULSHIFT32(fl[w], x0[i]) << 2;	x0[i] = xl;	mOutL |= FASTABS(xl);
+		if (++w == 3)
+			w = 0;
+	}
+	mOut[0] |= mOutL;
+	mOut[1] |= mOutR;
+}
+
 /**************************************************************************************
  * Function:    IntensityProcMPEG1
  *
@@ -92,6 +129,7 @@ void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2])
  *              two each of ScaleFactorInfoSub, CriticalBandInfo structs (both channels)
  *              flags indicating midSide on/off, mixedBlock on/off
  *              guard bit mask (left and right channels)
+ *              SIMD_xxx flags (uses the x86 SIMD IntensityRun() if available)
  *
  * Outputs:     updated sample vector x
  *              updated guard bit mask
@@ -104,13 +142,22 @@ void MidSideProc(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, int mOut[2])
  *              make sure all the mixed-block and IIP logic is right
  **************************************************************************************/
 void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh, ScaleFactorInfoSub *sfis, 
-						CriticalBandInfo *cbi, int midSideFlag, int mixFlag, int mOut[2])
+						CriticalBandInfo *cbi, int midSideFlag, int mixFlag, int mOut[2], int simdCaps)
 {
-	int i=0, j=0, n=0, cb=0, w=0;
-	int sampsLeft, isf, mOutL, mOutR, xl, xr;
+	int i=0, n=0, cb=0, w=0;
+	int sampsLeft, isf, mOutLR[2];
 	int fl, fr, fls[3], frs[3];
 	int cbStartL=0, cbStartS=0, cbEndL=0, cbEndS=0;
 	int *isfTab;
+	IntensityRunFunc intensityRun;
+
+	intensityRun = IntensityRun;
+#ifdef HELIX_X86_SIMD
+	if (simdCaps & SIMD_AVX2)
+		intensityRun = IntensityRunAVX2;
+	else if (simdCaps & SIMD_SSE41)
+		intensityRun = IntensityRunSSE41;
+#endif
 	
 	/* NOTE - this works fine for mixed blocks, as long as the switch point starts in the
 	 *  short block section (i.e. on or after sample 36 = sfBand->l[8] = 3*sfBand->s[3]
@@ -134,32 +181,33 @@ void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 
 	sampsLeft = nSamps - i;		/* process to length of left */
 	isfTab = (int *)ISFMpeg1[midSideFlag];
-	mOutL = mOutR = 0;
+	mOutLR[0] = mOutLR[1] = 0;
 
 	/* long blocks */
 	for (cb = cbStartL; cb < cbEndL && sampsLeft > 0; cb++) {
 		isf = sfis->l[cb];
-		if (isf == 7) {
+		if (isf >= 7) {
+			/* illegal intensity position (8 - 15 only in damaged streams, and would read past ISFMpeg1) */
 			fl = ISFIIP[midSideFlag][0];
 			fr = ISFIIP[midSideFlag][1];
 		} else {
 			fl = isfTab[isf];	
 			fr = isfTab[6] - isfTab[isf];
 		}
+		fls[0] = fls[1] = fls[2] = fl;
+		frs[0] = frs[1] = frs[2] = fr;
 
-		n = fh->sfBand->l[cb + 1] - fh->sfBand->l[cb];
-		for (j = 0; j < n && sampsLeft > 0; j++, i++) {
-			xr = MULSHIFT32(fr, x[0][i]) << 2;	x[1][i] = xr; mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fl, x[0][i]) << 2;	x[0][i] = xl; mOutL |= FASTABS(xl);
-			sampsLeft--;
-		}
+		n = MIN(fh->sfBand->l[cb + 1] - fh->sfBand->l[cb], sampsLeft);
+		intensityRun(x[0] + i, x[1] + i, n, fls, frs, mOutLR);
+		i += n;
+		sampsLeft -= n;
 	}
 
 	/* short blocks */
 	for (cb = cbStartS; cb < cbEndS && sampsLeft >= 3; cb++) {
 		for (w = 0; w < 3; w++) {
 			isf = sfis->s[cb][w];
-			if (isf == 7) {
+			if (isf >= 7) {
 				fls[w] = ISFIIP[midSideFlag][0];
 				frs[w] = ISFIIP[midSideFlag][1];
 			} else {
@@ -168,19 +216,14 @@ void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 			}
 		}
 
-		n = fh->sfBand->s[cb + 1] - fh->sfBand->s[cb];
-		for (j = 0; j < n && sampsLeft >= 3; j++, i+=3) {
-			xr = MULSHIFT32(frs[0], x[0][i+0]) << 2;	x[1][i+0] = xr;	mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fls[0], x[0][i+0]) << 2;	x[0][i+0] = xl;	mOutL |= FASTABS(xl);
-			xr = MULSHIFT32(frs[1], x[0][i+1]) << 2;	x[1][i+1] = xr;	mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fls[1], x[0][i+1]) << 2;	x[0][i+1] = xl;	mOutL |= FASTABS(xl);
-			xr = MULSHIFT32(frs[2], x[0][i+2]) << 2;	x[1][i+2] = xr;	mOutR |= FASTABS(xr);
-			xl = MULSHIFT32(fls[2], x[0][i+2]) << 2;	x[0][i+2] = xl;	mOutL |= FASTABS(xl);
-			sampsLeft -= 3;
-		}
+		/* windows are interleaved, so this is one run of 3*n samples with 3 repeating scales */
+		n = MIN(fh->sfBand->s[cb + 1] - fh->sfBand->s[cb], sampsLeft / 3);
+		intensityRun(x[0] + i, x[1] + i, 3*n, fls, frs, mOutLR);
+		i += 3*n;
+		sampsLeft -= 3*n;
 	}
-	mOut[0] = mOutL;
-	mOut[1] = mOutR;
+	mOut[0] = mOutLR[0];
+	mOut[1] = mOutLR[1];
 	
 	return;
 }
@@ -197,6 +240,7 @@ void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
  *              ScaleFactorJS struct with joint stereo info from UnpackSFMPEG2()
  *              flags indicating midSide on/off, mixedBlock on/off
  *              guard bit mask (left and right channels)
+ *              SIMD_xxx flags (uses the x86 SIMD IntensityRun() for long blocks if available)
  *
  * Outputs:     updated sample vector x
  *              updated guard bit mask
@@ -210,17 +254,28 @@ void IntensityProcMPEG1(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
  *                probably redo IIP logic to be simpler
  **************************************************************************************/
 void IntensityProcMPEG2(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh, ScaleFactorInfoSub *sfis, 
-						CriticalBandInfo *cbi, ScaleFactorJS *sfjs, int midSideFlag, int mixFlag, int mOut[2])
+						CriticalBandInfo *cbi, ScaleFactorJS *sfjs, int midSideFlag, int mixFlag, int mOut[2], int simdCaps)
 {
 	int i, j, k, n, r, cb, w;
 	int fl, fr, mOutL, mOutR, xl, xr;
 	int sampsLeft;
 	int isf, sfIdx, tmp, il[23];
+	int fls[3], frs[3], mOutLR[2];
 	int *isfTab;
 	int cbStartL, cbStartS, cbEndL, cbEndS;
+	IntensityRunFunc intensityRun;
+
+	intensityRun = IntensityRun;
+#ifdef HELIX_X86_SIMD
+	if (simdCaps & SIMD_AVX2)
+		intensityRun = IntensityRunAVX2;
+	else if (simdCaps & SIMD_SSE41)
+		intensityRun = IntensityRunSSE41;
+#endif
 	
 	isfTab = (int *)ISFMpeg2[sfjs->intensityScale][midSideFlag];
 	mOutL = mOutR = 0;
+	mOutLR[0] = mOutLR[1] = 0;
 
 	/* fill buffer with illegal intensity positions (depending on slen) */
 	for (k = r = 0; r < 4; r++) {
@@ -248,11 +303,10 @@ void IntensityProcMPEG2(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 				fr = isfTab[(sfIdx & 0x01 ? 0 : isf)];
 			}
 			n = MIN(fh->sfBand->l[cb + 1] - fh->sfBand->l[cb], sampsLeft);
-
-			for(j = 0; j < n; j++, i++) {
-				xr = MULSHIFT32(fr, x[0][i]) << 2;	x[1][i] = xr;	mOutR |= FASTABS(xr);
-				xl = MULSHIFT32(fl, x[0][i]) << 2;	x[0][i] = xl;	mOutL |= FASTABS(xl);
-			}
+			fls[0] = fls[1] = fls[2] = fl;
+			frs[0] = frs[1] = frs[2] = fr;
+			intensityRun(x[0] + i, x[1] + i, n, fls, frs, mOutLR);
+			i += n;
 
 			/* early exit once we've used all the non-zero samples */
 			sampsLeft -= n;
@@ -288,8 +342,8 @@ void IntensityProcMPEG2(int x[MAX_NCHAN][MAX_NSAMP], int nSamps, FrameHeader *fh
 			}
 		}
 	}
-	mOut[0] = mOutL;
-	mOut[1] = mOutR;
+	mOut[0] = mOutL | mOutLR[0];
+	mOut[1] = mOutR | mOutLR[1];
 
 	return;
 }
@@ -45,6 +45,120 @@
 #include "coder.h"
 #include "assembly.h"
 
+typedef void (*FDCT32Func)(int *x, int *d, int offset, int oddBlock, int gb);
+typedef void (*PolyphaseFunc)(short *pcm, int *vbuf, const int *coefBase);
+
+/**************************************************************************************
+ * Function:    MixToMono
+ *
+ * Description: downmix the IMDCT output of both channels into channel 0
+ *
+ * Inputs:      IMDCTInfo struct, after calling IMDCT for both channels
+ *
+ * Outputs:     (left + right) / 2 in outBuf[0], guard bits in gb[0]
+ *
+ * Return:      none
+ *
+ * Notes:       done after IMDCT, since each channel's overlap is windowed with its
+ *                own block type
+ **************************************************************************************/
+static void MixToMono(IMDCTInfo *mi)
+{
+	int b, i, nBands, *x0, *x1;
+
+	/* blocks at and above nBands are zero in both channels */
+	nBands = MAX(mi->nBands[0], mi->nBands[1]);
+	for (b = 0; b < BLOCK_SIZE; b++) {
+		x0 = mi->outBuf[0][b];
+		x1 = mi->outBuf[1][b];
+		for (i = 0; i < nBands; i++)
+			x0[i] = (x0[i] >> 1) + (x1[i] >> 1);
+	}
+	mi->nBands[0] = nBands;
+
+	/* halving each side first can't overflow, but may round up past a power of 2 */
+	mi->gb[0] = MAX(MIN(mi->gb[0], mi->gb[1]) - 1, 0);
+}
+
+/**************************************************************************************
+ * Function:    ClearGranule
+ *
+ * Description: write one granule of silence
+ *
+ * Inputs:      MP3DecInfo structure (output format)
+ *              PCM output buffer
+ *              samples per block per channel
+ *
+ * Outputs:     zeroed PCM for all output channels, laid out as Subband() would
+ *
+ * Return:      none
+ **************************************************************************************/
+static void ClearGranule(MP3DecInfo *mp3DecInfo, short *pcmBuf, int nOut)
+{
+	int i, ch, nWords, wordsPerSamp;
+
+	wordsPerSamp = (mp3DecInfo->bitsPerSample > 16 ? 2 : 1);
+	nWords = BLOCK_SIZE * nOut * wordsPerSamp;
+	if (mp3DecInfo->chanStride) {
+		for (ch = 0; ch < OUT_CHANS(mp3DecInfo); ch++) {
+			for (i = 0; i < nWords; i++)
+				pcmBuf[ch * mp3DecInfo->chanStride * wordsPerSamp + i] = 0;
+		}
+	} else {
+		for (i = 0; i < nWords * OUT_CHANS(mp3DecInfo); i++)
+			pcmBuf[i] = 0;
+	}
+}
+
+/**************************************************************************************
+ * Function:    Subband32
+ *
+ * Description: Subband() for 24/32-bit output
+ *
+ * Inputs:      filled MP3DecInfo structure, after calling IMDCT for all channels
+ *              PCM output buffer
+ *              DCT kernel picked by Subband()
+ *              channel to synthesize for mono output
+ *              flags for output channels whose DCT can be skipped (see Subband())
+ *
+ * Outputs:     decoded PCM data, as for Subband()
+ *
+ * Return:      none
+ **************************************************************************************/
+static void Subband32(MP3DecInfo *mp3DecInfo, int *pcmBuf, FDCT32Func fdct32, int srcCh, int *skipDCT)
+{
+	int b, outBits, step, nOut;
+	IMDCTInfo *mi;
+	SubbandInfo *sbi;
+
+	mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
+	sbi = (SubbandInfo*)(mp3DecInfo->SubbandInfoPS);
+	outBits = mp3DecInfo->bitsPerSample;
+	step = mp3DecInfo->decimate;
+	nOut = NBANDS / step;
+
+	for (b = 0; b < BLOCK_SIZE; b++) {
+		if (!skipDCT[0])
+			fdct32(mi->outBuf[srcCh][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[srcCh]);
+		if (OUT_CHANS(mp3DecInfo) == 2) {
+			if (!skipDCT[1])
+				fdct32(mi->outBuf[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), mi->gb[1]);
+			if (mp3DecInfo->chanStride) {
+				PolyphaseMono32(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef, outBits, step);
+				PolyphaseMono32(pcmBuf + mp3DecInfo->chanStride, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01) + 32, polyCoef, outBits, step);
+				pcmBuf += nOut;
+			} else {
+				PolyphaseStereo32(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef, outBits, step);
+				pcmBuf += (2 * nOut);
+			}
+		} else {
+			PolyphaseMono32(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef, outBits, step);
+			pcmBuf += nOut;
+		}
+		sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
+	}
+}
+
 /**************************************************************************************
  * Function:    Subband
  *
@@ -54,15 +168,25 @@
  *              vbuf[ch] and vindex[ch] must be preserved between calls
  *
  * Outputs:     decoded PCM data, interleaved LRLRLR... if stereo
+ *                or planar if mp3DecInfo->chanStride != 0 (right channel at 
+ *                pcmBuf + chanStride samples)
+ *                or mono, selected or mixed from stereo (mp3DecInfo->channelMode)
+ *              samples are shorts, or ints if mp3DecInfo->bitsPerSample > 16
+ *              NBANDS / mp3DecInfo->decimate samples per block per channel
  *
  * Return:      0 on success,  -1 if null input pointers
+ *
+ * Notes:       uses mi->nBands to skip silent channels and granules, and keeps it valid
+ *                for the next call to IMDCT
  **************************************************************************************/
 int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf)
 {
-	int b;
+	int b, ch, inCh, srcCh, nOut, zeroIn, skipDCT[MAX_NCHAN];
 	HuffmanInfo *hi;
 	IMDCTInfo *mi;
 	SubbandInfo *sbi;
+	FDCT32Func fdct32;
+	PolyphaseFunc polyStereo, polyMono;
 
 	/* validate pointers */
 	if (!mp3DecInfo || !mp3DecInfo->HuffmanInfoPS || !mp3DecInfo->IMDCTInfoPS || !mp3DecInfo->SubbandInfoPS)
@@ -72,22 +196,95 @@ int Subband(MP3DecInfo *mp3DecInfo, short *pcmBuf)
 	mi = (IMDCTInfo *)(mp3DecInfo->IMDCTInfoPS);
 	sbi = (SubbandInfo*)(mp3DecInfo->SubbandInfoPS);
 
-	if (mp3DecInfo->nChans == 2) {
+	/* pick the widest DCT and polyphase kernels this CPU supports (all are bit-exact with the C versions) */
+	fdct32 = FDCT32;
+	polyStereo = PolyphaseStereo;
+	polyMono = PolyphaseMono;
+#ifdef HELIX_X86_SIMD
+	if (mp3DecInfo->simdCaps & SIMD_AVX2) {
+		fdct32 = FDCT32AVX2;
+		polyStereo = PolyphaseStereoAVX2;
+		polyMono = PolyphaseMonoAVX2;
+	} else if (mp3DecInfo->simdCaps & SIMD_SSE41) {
+		fdct32 = FDCT32SSE41;
+		polyStereo = PolyphaseStereoSSE41;
+		polyMono = PolyphaseMonoSSE41;
+	}
+#endif
+
+	/* reduced-rate output (C only): the DCT is unchanged, the polyphase filter skips samples */
+	nOut = NBANDS / mp3DecInfo->decimate;
+	if (mp3DecInfo->decimate == 2) {
+		polyStereo = PolyphaseStereoHalf;
+		polyMono = PolyphaseMonoHalf;
+	} else if (mp3DecInfo->decimate == 4) {
+		polyStereo = PolyphaseStereoQuarter;
+		polyMono = PolyphaseMonoQuarter;
+	}
+
+	/* mono output from a stereo stream: synthesize one channel, or the mix of both */
+	srcCh = 0;
+	if (mp3DecInfo->nChans == 2 && mp3DecInfo->channelMode == MP3_CHANNELS_MIX)
+		MixToMono(mi);
+	else if (mp3DecInfo->nChans == 2 && mp3DecInfo->channelMode == MP3_CHANNELS_RIGHT)
+		srcCh = 1;
+
+	/* an output channel with all-zero input (mi->nBands == 0) can skip the DCT if its vbuf 
+	 *   holds only zeros already, i.e. the last granule was silent too (18 blocks flush the 
+	 *   whole 16-block history) - the DCT would just store zeros over zeros
+	 */
+	for (ch = 0; ch < MAX_NCHAN; ch++) {
+		inCh = (ch == 0 ? srcCh : 1);
+		zeroIn = (ch < OUT_CHANS(mp3DecInfo) && mi->nBands[inCh] == 0);
+		skipDCT[ch] = (zeroIn && sbi->vbufZero[ch]);
+		sbi->vbufZero[ch] = zeroIn;
+
+		/* the DCT works in place, so it leaves outBuf non-zero above nBands (unless the input was all zero) */
+		if (ch < OUT_CHANS(mp3DecInfo) && !zeroIn)
+			mi->nBands[inCh] = NBANDS;
+	}
+
+	/* silent granule: all output is zero, and vindex moves on by one per pair of blocks */
+	if (skipDCT[0] && (OUT_CHANS(mp3DecInfo) == 1 || skipDCT[1])) {
+		ClearGranule(mp3DecInfo, pcmBuf, nOut);
+		sbi->vindex = (sbi->vindex - BLOCK_SIZE / 2) & 7;
+		return 0;
+	}
+
+	if (mp3DecInfo->bitsPerSample > 16) {
+		/* 24/32-bit output (C only), straight from the 64-bit sums */
+		Subband32(mp3DecInfo, (int *)pcmBuf, fdct32, srcCh, skipDCT);
+	} else if (OUT_CHANS(mp3DecInfo) == 2 && mp3DecInfo->chanStride) {
+		/* stereo, planar - the mono kernels read one channel's half of each vbuf row */
+		for (b = 0; b < BLOCK_SIZE; b++) {
+			if (!skipDCT[0])
+				fdct32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
+			if (!skipDCT[1])
+				fdct32(mi->outBuf[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), mi->gb[1]);
+			polyMono(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
+			polyMono(pcmBuf + mp3DecInfo->chanStride, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01) + 32, polyCoef);
+			sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
+			pcmBuf += nOut;
+		}
+	} else if (OUT_CHANS(mp3DecInfo) == 2) {
 		/* stereo */
 		for (b = 0; b < BLOCK_SIZE; b++) {
-			FDCT32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
-			FDCT32(mi->outBuf[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), mi->gb[1]);
-			PolyphaseStereo(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
+			if (!skipDCT[0])
+				fdct32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
+			if (!skipDCT[1])
+				fdct32(mi->outBuf[1][b], sbi->vbuf + 1*32, sbi->vindex, (b & 0x01), mi->gb[1]);
+			polyStereo(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
 			sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
-			pcmBuf += (2 * NBANDS);
+			pcmBuf += (2 * nOut);
 		}
 	} else {
 		/* mono */
 		for (b = 0; b < BLOCK_SIZE; b++) {
-			FDCT32(mi->outBuf[0][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[0]);
-			PolyphaseMono(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
+			if (!skipDCT[0])
+				fdct32(mi->outBuf[srcCh][b], sbi->vbuf + 0*32, sbi->vindex, (b & 0x01), mi->gb[srcCh]);
+			polyMono(pcmBuf, sbi->vbuf + sbi->vindex + VBUF_LENGTH * (b & 0x01), polyCoef);
 			sbi->vindex = (sbi->vindex - (b & 0x01)) & 7;
-			pcmBuf += NBANDS;
+			pcmBuf += nOut;
 		}
 	}
 
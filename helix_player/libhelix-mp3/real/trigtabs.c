@@ -39,6 +39,9 @@
  * June 2003
  *
  * trigtabs.c - global ROM tables for pre-calculated trig coefficients
+ *
+ * The tables used on every granule (hybrid filterbank, DCT, polyphase filter) are 
+ *   cache-line aligned and kept together, the intensity stereo tables are kept out of their way
  **************************************************************************************/
 
 // constants in RAM are not significantly faster
@@ -100,7 +103,7 @@
  * 			win[i][j] *= 1.0 / sqrt(2);
  */
  
-const int imdctWin[4][36] = {
+CACHE_ALIGNED const int imdctWin[4][36] = {
 	{
 	0x02aace8b, 0x07311c28, 0x0a868fec, 0x0c913b52, 0x0d413ccd, 0x0c913b52, 0x0a868fec, 0x07311c28, 
 	0x02aace8b, 0xfd16d8dd, 0xf6a09e66, 0xef7a6275, 0xe7dbc161, 0xe0000000, 0xd8243e9f, 0xd0859d8b, 
@@ -131,98 +134,11 @@ const int imdctWin[4][36] = {
 	},
 };
 
-/* indexing = [mid-side off/on][intensity scale factor]
- * format = Q30, range = [0.0, 1.414]
- *
- * mid-side off: 
- *   ISFMpeg1[0][i] = tan(i*pi/12) / [1 + tan(i*pi/12)]  (left scalefactor)
- *                  =      1       / [1 + tan(i*pi/12)]  (right scalefactor)
- *
- * mid-side on: 
- *   ISFMpeg1[1][i] = sqrt(2) * ISFMpeg1[0][i]
- *
- * output L = ISFMpeg1[midSide][isf][0] * input L
- * output R = ISFMpeg1[midSide][isf][1] * input L
- *
- * obviously left scalefactor + right scalefactor = 1 (m-s off) or sqrt(2) (m-s on)
- *   so just store left and calculate right as 1 - left 
- *  (can derive as right = ISFMpeg1[x][6] - left)
- *
- * if mid-side enabled, multiply joint stereo scale factors by sqrt(2)
- *   - we scaled whole spectrum by 1/sqrt(2) in Dequant for the M+S/sqrt(2) in MidSideProc
- *   - but the joint stereo part of the spectrum doesn't need this, so we have to undo it
- *
- * if scale factor is and illegal intensity position, this becomes a passthrough
- *   - gain = [1, 0] if mid-side off, since L is coded directly and R = 0 in this region
- *   - gain = [1, 1] if mid-side on, since L = (M+S)/sqrt(2), R = (M-S)/sqrt(2)
- *     - and since S = 0 in the joint stereo region (above NZB right) then L = R = M * 1.0
- */
-const int ISFMpeg1[2][7] = {
-	{0x00000000, 0x0d8658ba, 0x176cf5d0, 0x20000000, 0x28930a2f, 0x3279a745, 0x40000000},
-	{0x00000000, 0x13207f5c, 0x2120fb83, 0x2d413ccc, 0x39617e16, 0x4761fa3d, 0x5a827999}
-};
-
-/* indexing = [intensity scale on/off][mid-side off/on][intensity scale factor]
- * format = Q30, range = [0.0, 1.414]
- *
- * if (isf == 0)                 kl = 1.0             kr = 1.0
- * else if (isf & 0x01 == 0x01)  kl = i0^((isf+1)/2), kr = 1.0
- * else if (isf & 0x01 == 0x00)  kl = 1.0,            kr = i0^(isf/2)
- *
- * if (intensityScale == 1)      i0 = 1/sqrt(2)       = 0x2d413ccc (Q30)
- * else                          i0 = 1/sqrt(sqrt(2)) = 0x35d13f32 (Q30)
- *
- * see comments for ISFMpeg1 (just above) regarding scaling, sqrt(2), etc.
- *
- * compress the MPEG2 table using the obvious identities above...
- * for isf = [0, 1, 2, ... 30], let sf = table[(isf+1) >> 1] 
- *   - if isf odd,  L = sf*L,     R = tab[0]*R
- *   - if isf even, L = tab[0]*L, R = sf*R
- */
-const int ISFMpeg2[2][2][16] = {
-{
-	{
-		/* intensityScale off, mid-side off */
-		0x40000000, 0x35d13f32, 0x2d413ccc, 0x260dfc14, 0x1fffffff, 0x1ae89f99, 0x16a09e66, 0x1306fe0a, 
-		0x0fffffff, 0x0d744fcc, 0x0b504f33, 0x09837f05, 0x07ffffff, 0x06ba27e6, 0x05a82799, 0x04c1bf82,
-	},
-	{
-		/* intensityScale off, mid-side on */
-		0x5a827999, 0x4c1bf827, 0x3fffffff, 0x35d13f32, 0x2d413ccc, 0x260dfc13, 0x1fffffff, 0x1ae89f99, 
-		0x16a09e66, 0x1306fe09, 0x0fffffff, 0x0d744fcc, 0x0b504f33, 0x09837f04, 0x07ffffff, 0x06ba27e6, 
-	},
-},
-{
-	{
-		/* intensityScale on, mid-side off */
-		0x40000000, 0x2d413ccc, 0x20000000, 0x16a09e66, 0x10000000, 0x0b504f33, 0x08000000, 0x05a82799, 
-		0x04000000, 0x02d413cc, 0x02000000, 0x016a09e6, 0x01000000, 0x00b504f3, 0x00800000, 0x005a8279, 
-	},
-		/* intensityScale on, mid-side on */
-	{
-		0x5a827999, 0x3fffffff, 0x2d413ccc, 0x1fffffff, 0x16a09e66, 0x0fffffff, 0x0b504f33, 0x07ffffff, 
-		0x05a82799, 0x03ffffff, 0x02d413cc, 0x01ffffff, 0x016a09e6, 0x00ffffff, 0x00b504f3, 0x007fffff, 
-	}
-}
-};
-
-/* indexing = [intensity scale on/off][left/right]
- * format = Q30, range = [0.0, 1.414]
- *
- * illegal intensity position scalefactors (see comments on ISFMpeg1)
- */
-const int ISFIIP[2][2] = {
-	{0x40000000, 0x00000000}, /* mid-side off */
-	{0x40000000, 0x40000000}, /* mid-side on */
-};
-
-const unsigned char uniqueIDTab[8] = {0x5f, 0x4b, 0x43, 0x5f, 0x5f, 0x4a, 0x52, 0x5f};
-
 /* anti-alias coefficients - see spec Annex B, table 3-B.9 
  *   csa[0][i] = CSi, csa[1][i] = CAi
  * format = Q31
  */
-const int csa[8][2] = {
+CACHE_ALIGNED const int csa[8][2] = {
 	{0x6dc253f0, 0xbe2500aa}, 
 	{0x70dcebe4, 0xc39e4949},
 	{0x798d6e73, 0xd7e33f4a},
@@ -245,7 +161,7 @@ const int csa[8][2] = {
  * }
  * coef32[30] *= 0.5;	/ *** for initial back butterfly (i.e. two-point DCT) *** /
  */
-const int coef32[31] = {
+CACHE_ALIGNED const int coef32[31] = {
 	0x7fd8878d, 0x7e9d55fc, 0x7c29fbee, 0x78848413, 0x73b5ebd0, 0x6dca0d14, 0x66cf811f, 0x5ed77c89, 
 	0x55f5a4d2, 0x4c3fdff3, 0x41ce1e64, 0x36ba2013, 0x2b1f34eb, 0x1f19f97b, 0x12c8106e, 0x0647d97c, 
 	0x7f62368f, 0x7a7d055b, 0x70e2cbc6, 0x62f201ac, 0x5133cc94, 0x3c56ba70, 0x25280c5d, 0x0c8bd35e, 
@@ -275,7 +191,7 @@ const int coef32[31] = {
  * polyCoef[256, 257, ... 263] are for special case of sample 16 (out of 0)
  *   see PolyphaseStereo() and PolyphaseMono()
  */
-const int polyCoef[264] = {
+CACHE_ALIGNED const int polyCoef[264] = {
 	/* shuffled vs. original from 0, 1, ... 15 to 0, 15, 2, 13, ... 14, 1 */
 	0x00000000, 0x00000074, 0x00000354, 0x0000072c, 0x00001fd4, 0x00005084, 0x000066b8, 0x000249c4,
 	0x00049478, 0xfffdb63c, 0x000066b8, 0xffffaf7c, 0x00001fd4, 0xfffff8d4, 0x00000354, 0xffffff8c,
@@ -312,3 +228,91 @@ const int polyCoef[264] = {
 	0x000001a0, 0x0000187c, 0x000097fc, 0x0003e84c, 0xffff6424, 0xffffff4c, 0x00000248, 0xffffffec, 
 };
 
+/* cold tables - only read for intensity stereo, so kept after the filterbank tables */
+
+/* indexing = [mid-side off/on][intensity scale factor]
+ * format = Q30, range = [0.0, 1.414]
+ *
+ * mid-side off: 
+ *   ISFMpeg1[0][i] = tan(i*pi/12) / [1 + tan(i*pi/12)]  (left scalefactor)
+ *                  =      1       / [1 + tan(i*pi/12)]  (right scalefactor)
+ *
+ * mid-side on: 
+ *   ISFMpeg1[1][i] = sqrt(2) * ISFMpeg1[0][i]
+ *
+ * output L = ISFMpeg1[midSide][isf][0] * input L
+ * output R = ISFMpeg1[midSide][isf][1] * input L
+ *
+ * obviously left scalefactor + right scalefactor = 1 (m-s off) or sqrt(2) (m-s on)
+ *   so just store left and calculate right as 1 - left 
+ *  (can derive as right = ISFMpeg1[x][6] - left)
+ *
+ * if mid-side enabled, multiply joint stereo scale factors by sqrt(2)
+ *   - we scaled whole spectrum by 1/sqrt(2) in Dequant for the M+S/sqrt(2) in MidSideProc
+ *   - but the joint stereo part of the spectrum doesn't need this, so we have to undo it
+ *
+ * if scale factor is and illegal intensity position, this becomes a passthrough
+ *   - gain = [1, 0] if mid-side off, since L is coded directly and R = 0 in this region
+ *   - gain = [1, 1] if mid-side on, since L = (M+S)/sqrt(2), R = (M-S)/sqrt(2)
+ *     - and since S = 0 in the joint stereo region (above NZB right) then L = R = M * 1.0
+ */
+const int ISFMpeg1[2][7] = {
+	{0x00000000, 0x0d8658ba, 0x176cf5d0, 0x20000000, 0x28930a2f, 0x3279a745, 0x40000000},
+	{0x00000000, 0x13207f5c, 0x2120fb83, 0x2d413ccc, 0x39617e16, 0x4761fa3d, 0x5a827999}
+};
+
+/* indexing = [intensity scale on/off][mid-side off/on][intensity scale factor]
+ * format = Q30, range = [0.0, 1.414]
+ *
+ * if (isf == 0)                 kl = 1.0             kr = 1.0
+ * else if (isf & 0x01 == 0x01)  kl = i0^((isf+1)/2), kr = 1.0
+ * else if (isf & 0x01 == 0x00)  kl = 1.0,            kr = i0^(isf/2)
+ *
+ * if (intensityScale == 1)      i0 = 1/sqrt(2)       = 0x2d413ccc (Q30)
+ * else                          i0 = 1/sqrt(sqrt(2)) = 0x35d13f32 (Q30)
+ *
+ * see comments for ISFMpeg1 (just above) regarding scaling, sqrt(2), etc.
+ *
+ * compress the MPEG2 table using the obvious identities above...
+ * for isf = [0, 1, 2, ... 30], let sf = table[(isf+1) >> 1] 
+ *   - if isf odd,  L = sf*L,     R = tab[0]*R
+ *   - if isf even, L = tab[0]*L, R = sf*R
+ */
+const int ISFMpeg2[2][2][16] = {
+{
+	{
+		/* intensityScale off, mid-side off */
+		0x40000000, 0x35d13f32, 0x2d413ccc, 0x260dfc14, 0x1fffffff, 0x1ae89f99, 0x16a09e66, 0x1306fe0a, 
+		0x0fffffff, 0x0d744fcc, 0x0b504f33, 0x09837f05, 0x07ffffff, 0x06ba27e6, 0x05a82799, 0x04c1bf82,
+	},
+	{
+		/* intensityScale off, mid-side on */
+		0x5a827999, 0x4c1bf827, 0x3fffffff, 0x35d13f32, 0x2d413ccc, 0x260dfc13, 0x1fffffff, 0x1ae89f99, 
+		0x16a09e66, 0x1306fe09, 0x0fffffff, 0x0d744fcc, 0x0b504f33, 0x09837f04, 0x07ffffff, 0x06ba27e6, 
+	},
+},
+{
+	{
+		/* intensityScale on, mid-side off */
+		0x40000000, 0x2d413ccc, 0x20000000, 0x16a09e66, 0x10000000, 0x0b504f33, 0x08000000, 0x05a82799, 
+		0x04000000, 0x02d413cc, 0x02000000, 0x016a09e6, 0x01000000, 0x00b504f3, 0x00800000, 0x005a8279, 
+	},
+		/* intensityScale on, mid-side on */
+	{
+		0x5a827999, 0x3fffffff, 0x2d413ccc, 0x1fffffff, 0x16a09e66, 0x0fffffff, 0x0b504f33, 0x07ffffff, 
+		0x05a82799, 0x03ffffff, 0x02d413cc, 0x01ffffff, 0x016a09e6, 0x00ffffff, 0x00b504f3, 0x007fffff, 
+	}
+}
+};
+
+/* indexing = [intensity scale on/off][left/right]
+ * format = Q30, range = [0.0, 1.414]
+ *
+ * illegal intensity position scalefactors (see comments on ISFMpeg1)
+ */
+const int ISFIIP[2][2] = {
+	{0x40000000, 0x00000000}, /* mid-side off */
+	{0x40000000, 0x40000000}, /* mid-side on */
+};
+
+const unsigned char uniqueIDTab[8] = {0x5f, 0x4b, 0x43, 0x5f, 0x5f, 0x4a, 0x52, 0x5f};
@@ -0,0 +1,77 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * cpux86.c - run-time detection of x86 SIMD extensions
+ **************************************************************************************/
+
+#include "../coder.h"
+
+/**************************************************************************************
+ * Function:    GetSIMDCaps
+ *
+ * Description: query CPUID for the instruction set extensions used by the SIMD kernels
+ *
+ * Inputs:      none
+ *
+ * Outputs:     none
+ *
+ * Return:      bitmask of SIMD_xxx flags (see coder.h), 0 if SIMD kernels are not 
+ *                built for this platform
+ *
+ * Notes:       called once per decoder instance, from MP3InitDecoder()
+ *              the compiler runtime also checks that the OS saves the AVX state 
+ *                (XGETBV), so SIMD_AVX2 is only reported if it's actually usable
+ **************************************************************************************/
+int GetSIMDCaps(void)
+{
+#ifdef HELIX_X86_SIMD
+	int caps = 0;
+
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2"))
+		caps |= SIMD_SSE2;
+	if (__builtin_cpu_supports("sse4.1"))
+		caps |= SIMD_SSE41;
+	if (__builtin_cpu_supports("avx2"))
+		caps |= SIMD_AVX2;
+
+	return caps;
+#else
+	return 0;
+#endif
+}
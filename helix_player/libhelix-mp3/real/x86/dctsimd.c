@@ -0,0 +1,280 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * dctsimd.c - SSE4.1 and AVX2 versions of the 32-point DCT for the polyphase filter
+ *
+ * These produce exactly the same output as FDCT32() in dct32.c.
+ * MULSHIFT32 is done with packed signed 32x32 -> 64 multiplies (pmuldq) on the even and
+ *   odd lanes, keeping the top 32 bits of each product. The per-butterfly shifts
+ *   (which depend on the Q format of each coefficient) are applied per lane.
+ * The first pass runs all 8 butterflies in parallel, the second pass runs the 4 groups
+ *   of 8 in parallel (transposed), and the output shuffle into vbuf is the scalar 
+ *   FDCT32Output() from dct32.c, since every output sample goes to a different row of 
+ *   the polyphase buffer.
+ *
+ * Selected at run time in Subband(), based on the CPU flags from GetSIMDCaps()
+ **************************************************************************************/
+
+#include "../coder.h"
+
+#ifdef HELIX_X86_SIMD
+
+#include "simdx86.h"
+
+#define COS4_0  0x5a82799a	/* Q31 */
+
+/* first pass shifts (Q format of each coefficient in dcttab), lane i = butterfly i */
+static const int fpS1[8] __attribute__((aligned(32))) = { 5, 3, 3, 2, 2, 1, 1, 1 };
+static const int fpS2[8] __attribute__((aligned(32))) = { 1, 1, 1, 1, 1, 2, 2, 4 };
+
+/* 1 << fpS1, 1 << fpS2 (SSE4.1 has no per-lane shift, so these shifts are done with pmulld) */
+static const int fpM1[8] __attribute__((aligned(32))) = { 32, 8, 8, 4, 4, 2, 2, 2 };
+static const int fpM2[8] __attribute__((aligned(32))) = {  2, 2, 2, 2, 2, 4, 4, 16 };
+
+/* the coefficients themselves come from dcttab (dct32.c), one column per vector:
+ *   first pass  - dcttab[3*i + k], lane i = butterfly i
+ *   second pass - dcttab[24 + 6*g + k], lane g = group g
+ */
+#define DCTCOL(p, s)	_mm_setr_epi32((p)[0], (p)[s], (p)[2*(s)], (p)[3*(s)])
+
+/* 4x4 transpose of 32-bit elements (its own inverse) */
+#define TRANSPOSE4(r0, r1, r2, r3) { \
+	__m128i t0, t1, t2, t3; \
+	t0 = _mm_unpacklo_epi32(r0, r1);	t1 = _mm_unpacklo_epi32(r2, r3); \
+	t2 = _mm_unpackhi_epi32(r0, r1);	t3 = _mm_unpackhi_epi32(r2, r3); \
+	r0 = _mm_unpacklo_epi64(t0, t1);	r1 = _mm_unpackhi_epi64(t0, t1); \
+	r2 = _mm_unpacklo_epi64(t2, t3);	r3 = _mm_unpackhi_epi64(t2, t3); \
+}
+
+#define REV4	_MM_SHUFFLE(0,1,2,3)
+
+/**************************************************************************************
+ * SSE4.1 - 4 lanes
+ **************************************************************************************/
+
+#define LDSSE(p)	_mm_load_si128((const __m128i *)(p))
+#define LDUSSE(p)	_mm_loadu_si128((const __m128i *)(p))
+
+/* butterflies i to i+3 of the first pass (see D32FP in dct32.c) 
+ * outputs are in buf order: x0 = buf[i..i+3], x1 = buf[12-i..15-i], x2 = buf[16+i..19+i], x3 = buf[28-i..31-i]
+ */
+#define D32FPSSE(i, x0, x1, x2, x3) { \
+	__m128i a0_, a1_, a2_, a3_, b0_, b1_, b2_, b3_, c0_, c1_, c2_; \
+	c0_ = DCTCOL(dcttab + 3*(i) + 0, 3); \
+	c1_ = DCTCOL(dcttab + 3*(i) + 1, 3); \
+	c2_ = DCTCOL(dcttab + 3*(i) + 2, 3); \
+	a0_ = _mm_sra_epi32(LDUSSE(buf + (i)), esv); \
+	a1_ = _mm_sra_epi32(_mm_shuffle_epi32(LDUSSE(buf + 12 - (i)), REV4), esv); \
+	a2_ = _mm_sra_epi32(LDUSSE(buf + 16 + (i)), esv); \
+	a3_ = _mm_sra_epi32(_mm_shuffle_epi32(LDUSSE(buf + 28 - (i)), REV4), esv); \
+	b0_ = _mm_add_epi32(a0_, a3_);	b3_ = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a0_, a3_), c0_), 1); \
+	b1_ = _mm_add_epi32(a1_, a2_);	b2_ = _mm_mullo_epi32(MulShift32SSE(_mm_sub_epi32(a1_, a2_), c1_), LDSSE(fpM1 + (i))); \
+	x0 = _mm_add_epi32(b0_, b1_);	x1 = _mm_mullo_epi32(MulShift32SSE(_mm_sub_epi32(b0_, b1_), c2_), LDSSE(fpM2 + (i))); \
+	x2 = _mm_add_epi32(b2_, b3_);	x3 = _mm_mullo_epi32(MulShift32SSE(_mm_sub_epi32(b3_, b2_), c2_), LDSSE(fpM2 + (i))); \
+	x1 = _mm_shuffle_epi32(x1, REV4); \
+	x3 = _mm_shuffle_epi32(x3, REV4); \
+}
+
+/**************************************************************************************
+ * Function:    FDCT32SSE41
+ *
+ * Description: SSE4.1 version of FDCT32() (see dct32.c)
+ **************************************************************************************/
+__attribute__((target("sse4.1")))
+void FDCT32SSE41(int *buf, int *dest, int offset, int oddBlock, int gb)
+{
+	int es;
+	__m128i esv, cos4, cp0, cp1, cp2, cp3, cp4, cp5;
+	__m128i a0, a1, a2, a3, a4, a5, a6, a7;
+	__m128i b0, b1, b2, b3, b4, b5, b6, b7;
+
+	/* scaling - ensure at least 6 guard bits for DCT (applied as the input is loaded) */
+	es = 0;
+	if (gb < 6)
+		es = 6 - gb;
+	esv = _mm_cvtsi32_si128(es);
+
+	/* first pass - outputs are the rows buf[8*g .. 8*g+7] for the second pass, a0-a3 = left half, a4-a7 = right half */
+	D32FPSSE(0, a0, a5, a2, a7);
+	D32FPSSE(4, a4, a1, a6, a3);
+
+	/* second pass - transpose so lane g = group g */
+	TRANSPOSE4(a0, a1, a2, a3);
+	TRANSPOSE4(a4, a5, a6, a7);
+
+	cp0 = DCTCOL(dcttab + 24, 6);	cp1 = DCTCOL(dcttab + 25, 6);	cp2 = DCTCOL(dcttab + 26, 6);
+	cp3 = DCTCOL(dcttab + 27, 6);	cp4 = DCTCOL(dcttab + 28, 6);	cp5 = DCTCOL(dcttab + 29, 6);
+
+	b0 = _mm_add_epi32(a0, a7);	b7 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a0, a7), cp0), 1);
+	b3 = _mm_add_epi32(a3, a4);	b4 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a3, a4), cp1), 3);
+	a0 = _mm_add_epi32(b0, b3);	a3 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(b0, b3), cp2), 1);
+	a4 = _mm_add_epi32(b4, b7);	a7 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(b7, b4), cp2), 1);
+
+	b1 = _mm_add_epi32(a1, a6);	b6 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a1, a6), cp3), 1);
+	b2 = _mm_add_epi32(a2, a5);	b5 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a2, a5), cp4), 1);
+	a1 = _mm_add_epi32(b1, b2);	a2 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(b1, b2), cp5), 2);
+	a5 = _mm_add_epi32(b5, b6);	a6 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(b6, b5), cp5), 2);
+
+	cos4 = _mm_set1_epi32(COS4_0);
+	b0 = _mm_add_epi32(a0, a1);	b1 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a0, a1), cos4), 1);
+	b2 = _mm_add_epi32(a2, a3);	b3 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a3, a2), cos4), 1);
+	b4 = _mm_add_epi32(a4, a5);	b5 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a4, a5), cos4), 1);
+	b6 = _mm_add_epi32(a6, a7);	b7 = _mm_slli_epi32(MulShift32SSE(_mm_sub_epi32(a7, a6), cos4), 1);
+	b6 = _mm_add_epi32(b6, b7);
+
+	a0 = b0;					a1 = b1;
+	a2 = _mm_add_epi32(b2, b3);	a3 = b3;
+	a4 = _mm_add_epi32(b4, b6);	a5 = _mm_add_epi32(b5, b7);
+	a6 = _mm_add_epi32(b5, b6);	a7 = b7;
+
+	/* transpose back (a0-a3 = left half of each row, a4-a7 = right half) */
+	TRANSPOSE4(a0, a1, a2, a3);
+	TRANSPOSE4(a4, a5, a6, a7);
+	_mm_storeu_si128((__m128i *)(buf +  0), a0);	_mm_storeu_si128((__m128i *)(buf +  4), a4);
+	_mm_storeu_si128((__m128i *)(buf +  8), a1);	_mm_storeu_si128((__m128i *)(buf + 12), a5);
+	_mm_storeu_si128((__m128i *)(buf + 16), a2);	_mm_storeu_si128((__m128i *)(buf + 20), a6);
+	_mm_storeu_si128((__m128i *)(buf + 24), a3);	_mm_storeu_si128((__m128i *)(buf + 28), a7);
+
+	FDCT32Output(buf, dest, offset, oddBlock, es);
+}
+
+/**************************************************************************************
+ * AVX2 - 8 lanes
+ **************************************************************************************/
+
+#define LDAVX(p)	_mm256_load_si256((const __m256i *)(p))
+#define LDUAVX(p)	_mm256_loadu_si256((const __m256i *)(p))
+
+/* (lo | hi) from two 128-bit halves */
+#define PAIRAVX(lo, hi)	_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1)
+
+/**************************************************************************************
+ * Function:    FDCT32AVX2
+ *
+ * Description: AVX2 version of FDCT32() (see dct32.c)
+ *
+ * Notes:       second pass keeps two columns of the transposed data per register
+ *                (4 groups in each 128-bit half), paired so that both halves need
+ *                the same operation
+ **************************************************************************************/
+__attribute__((target("avx2")))
+void FDCT32AVX2(int *buf, int *dest, int offset, int oddBlock, int gb)
+{
+	int es;
+	__m128i esv, s1l, s1h, m1l, m1h, s2l, s2h, m2l, m2h, b6;
+	__m256i rev, cos4, sh1, sh2, c0, c1, c2, t0, t1, t2, t3;
+	__m256i a0, a1, a2, a3, b0, b1, b2, b3;
+	__m256i r0, r1, r2, r3;
+
+	/* scaling - ensure at least 6 guard bits for DCT (applied as the input is loaded) */
+	es = 0;
+	if (gb < 6)
+		es = 6 - gb;
+	esv = _mm_cvtsi32_si128(es);
+
+	/* first pass - all 8 butterflies at once (see D32FP in dct32.c) */
+	rev = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+	a0 = _mm256_sra_epi32(LDUAVX(buf +  0), esv);
+	a1 = _mm256_sra_epi32(_mm256_permutevar8x32_epi32(LDUAVX(buf +  8), rev), esv);
+	a2 = _mm256_sra_epi32(LDUAVX(buf + 16), esv);
+	a3 = _mm256_sra_epi32(_mm256_permutevar8x32_epi32(LDUAVX(buf + 24), rev), esv);
+
+	c0 = PAIRAVX(DCTCOL(dcttab +  0, 3), DCTCOL(dcttab + 12, 3));
+	c1 = PAIRAVX(DCTCOL(dcttab +  1, 3), DCTCOL(dcttab + 13, 3));
+	c2 = PAIRAVX(DCTCOL(dcttab +  2, 3), DCTCOL(dcttab + 14, 3));
+	b0 = _mm256_add_epi32(a0, a3);	b3 = _mm256_slli_epi32(MulShift32AVX(_mm256_sub_epi32(a0, a3), c0), 1);
+	b1 = _mm256_add_epi32(a1, a2);	b2 = _mm256_sllv_epi32(MulShift32AVX(_mm256_sub_epi32(a1, a2), c1), LDAVX(fpS1));
+	r0 = _mm256_add_epi32(b0, b1);	r1 = _mm256_sllv_epi32(MulShift32AVX(_mm256_sub_epi32(b0, b1), c2), LDAVX(fpS2));
+	r2 = _mm256_add_epi32(b2, b3);	r3 = _mm256_sllv_epi32(MulShift32AVX(_mm256_sub_epi32(b3, b2), c2), LDAVX(fpS2));
+	r1 = _mm256_permutevar8x32_epi32(r1, rev);
+	r3 = _mm256_permutevar8x32_epi32(r3, rev);
+
+	/* second pass - transpose rows r0-r3 into (a0 | a4), (a1 | a5), (a2 | a6), (a3 | a7), lane g = group g */
+	t0 = _mm256_unpacklo_epi32(r0, r1);	t1 = _mm256_unpacklo_epi32(r2, r3);
+	t2 = _mm256_unpackhi_epi32(r0, r1);	t3 = _mm256_unpackhi_epi32(r2, r3);
+	r0 = _mm256_unpacklo_epi64(t0, t1);	r1 = _mm256_unpackhi_epi64(t0, t1);
+	r2 = _mm256_unpacklo_epi64(t2, t3);	r3 = _mm256_unpackhi_epi64(t2, t3);
+
+	a0 = _mm256_permute2x128_si256(r0, r1, 0x20);	/* a0 | a1 */
+	a1 = _mm256_permute2x128_si256(r3, r2, 0x31);	/* a7 | a6 */
+	a2 = _mm256_permute2x128_si256(r3, r2, 0x20);	/* a3 | a2 */
+	a3 = _mm256_permute2x128_si256(r0, r1, 0x31);	/* a4 | a5 */
+
+	c0 = PAIRAVX(DCTCOL(dcttab + 24, 6), DCTCOL(dcttab + 27, 6));	/* cp0 | cp3 */
+	c1 = PAIRAVX(DCTCOL(dcttab + 25, 6), DCTCOL(dcttab + 28, 6));	/* cp1 | cp4 */
+	c2 = PAIRAVX(DCTCOL(dcttab + 26, 6), DCTCOL(dcttab + 29, 6));	/* cp2 | cp5 */
+	sh1 = _mm256_setr_epi32(3, 3, 3, 3, 1, 1, 1, 1);
+	sh2 = _mm256_setr_epi32(1, 1, 1, 1, 2, 2, 2, 2);
+	b0 = _mm256_add_epi32(a0, a1);	b1 = _mm256_slli_epi32(MulShift32AVX(_mm256_sub_epi32(a0, a1), c0), 1);		/* b0 | b1, b7 | b6 */
+	b2 = _mm256_add_epi32(a2, a3);	b3 = _mm256_sllv_epi32(MulShift32AVX(_mm256_sub_epi32(a2, a3), c1), sh1);	/* b3 | b2, b4 | b5 */
+	a0 = _mm256_add_epi32(b0, b2);	a1 = _mm256_sllv_epi32(MulShift32AVX(_mm256_sub_epi32(b0, b2), c2), sh2);	/* a0 | a1, a3 | a2 */
+	a2 = _mm256_add_epi32(b3, b1);	a3 = _mm256_sllv_epi32(MulShift32AVX(_mm256_sub_epi32(b1, b3), c2), sh2);	/* a4 | a5, a7 | a6 */
+
+	cos4 = _mm256_set1_epi32(COS4_0);
+	b0 = _mm256_permute2x128_si256(a0, a1, 0x20);	/* a0 | a3 */
+	b1 = _mm256_permute2x128_si256(a0, a1, 0x31);	/* a1 | a2 */
+	b2 = _mm256_permute2x128_si256(a2, a3, 0x20);	/* a4 | a7 */
+	b3 = _mm256_permute2x128_si256(a2, a3, 0x31);	/* a5 | a6 */
+	a0 = _mm256_add_epi32(b0, b1);	a1 = _mm256_slli_epi32(MulShift32AVX(_mm256_sub_epi32(b0, b1), cos4), 1);	/* b0 | b2, b1 | b3 */
+	a2 = _mm256_add_epi32(b2, b3);	a3 = _mm256_slli_epi32(MulShift32AVX(_mm256_sub_epi32(b2, b3), cos4), 1);	/* b4 | b6, b5 | b7 */
+
+	s1l = _mm256_castsi256_si128(a0);	s1h = _mm256_extracti128_si256(a0, 1);
+	m1l = _mm256_castsi256_si128(a1);	m1h = _mm256_extracti128_si256(a1, 1);
+	s2l = _mm256_castsi256_si128(a2);	s2h = _mm256_extracti128_si256(a2, 1);
+	m2l = _mm256_castsi256_si128(a3);	m2h = _mm256_extracti128_si256(a3, 1);
+	b6 = _mm_add_epi32(s2h, m2h);
+
+	/* outputs 0-7, paired as (0 | 4), (1 | 5), (2 | 6), (3 | 7) */
+	a0 = PAIRAVX(s1l, _mm_add_epi32(s2l, b6));
+	a1 = PAIRAVX(m1l, _mm_add_epi32(m2l, m2h));
+	a2 = PAIRAVX(_mm_add_epi32(s1h, m1h), _mm_add_epi32(m2l, b6));
+	a3 = PAIRAVX(m1h, m2h);
+
+	/* transpose back to rows */
+	t0 = _mm256_unpacklo_epi32(a0, a1);	t1 = _mm256_unpackhi_epi32(a0, a1);
+	t2 = _mm256_unpacklo_epi32(a2, a3);	t3 = _mm256_unpackhi_epi32(a2, a3);
+	_mm256_storeu_si256((__m256i *)(buf +  0), _mm256_unpacklo_epi64(t0, t2));
+	_mm256_storeu_si256((__m256i *)(buf +  8), _mm256_unpackhi_epi64(t0, t2));
+	_mm256_storeu_si256((__m256i *)(buf + 16), _mm256_unpacklo_epi64(t1, t3));
+	_mm256_storeu_si256((__m256i *)(buf + 24), _mm256_unpackhi_epi64(t1, t3));
+
+	FDCT32Output(buf, dest, offset, oddBlock, es);
+}
+
+#endif	/* HELIX_X86_SIMD */
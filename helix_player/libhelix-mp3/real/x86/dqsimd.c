@@ -0,0 +1,201 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * dqsimd.c - AVX2 version of DequantBlock(), 8 coefficients at a time
+ *
+ * All the scale shifts in DequantBlock() are the same for every sample in a block 
+ *   except in the x >= 64 (polynomial) case, so the common cases need no per-lane 
+ *   shifts or gathers:
+ *     x < 16:       pow43_14[] row held in two registers, looked up with vpermd
+ *     16 <= x < 64: pow43[] held in six registers, also looked up with vpermd
+ *     x >= 64:      polynomial, with per-lane shifts (only if the block has any)
+ *
+ * Selected at run time in DequantChannel(), based on the CPU flags from GetSIMDCaps()
+ **************************************************************************************/
+
+#include "../coder.h"
+#include "../assembly.h"
+
+#ifdef HELIX_X86_SIMD
+
+#include "simdx86.h"
+
+/* sqrt(0.5) in Q31 format, same as dqchan.c */
+#define SQRTHALF 0x5a82799a
+
+/**************************************************************************************
+ * Function:    Pow43LargeAVX2
+ *
+ * Description: the x >= 16 part of DequantBlock(), including fractional and integer 
+ *                scale
+ *
+ * Inputs:      8 magnitudes (lanes with x < 16 are ignored)
+ *              pow43[] (48 entries) in 6 registers
+ *              fractional and integer scale, from DequantBlock()
+ *
+ * Outputs:     none
+ *
+ * Return:      8 unsigned dequantized samples (garbage in lanes with x < 16)
+ **************************************************************************************/
+__attribute__((target("avx2")))
+static __inline __m256i Pow43LargeAVX2(__m256i x, const __m256i *tab48, int scalef, int scalei)
+{
+	__m256i y, yp, xn, xi, m, sh, shift, isPoly, ls, clip, maxPos;
+	int k;
+
+	/* 16 <= x < 64 - table lookup, 8 entries per register (lanes with x >= 64 are don't care) */
+	xi = _mm256_sub_epi32(x, _mm256_set1_epi32(16));
+	y = _mm256_permutevar8x32_epi32(tab48[0], xi);
+	for (k = 1; k < 6; k++) {
+		m = _mm256_cmpgt_epi32(xi, _mm256_set1_epi32(8*k - 1));
+		y = _mm256_blendv_epi8(y, _mm256_permutevar8x32_epi32(tab48[k], xi), m);
+	}
+	y = MulShift32AVX(y, _mm256_set1_epi32(scalef));
+	shift = _mm256_set1_epi32(scalei - 3);
+
+	/* x >= 64 - polynomial */
+	isPoly = _mm256_cmpgt_epi32(x, _mm256_set1_epi32(63));
+	if (!_mm256_testz_si256(isPoly, isPoly)) {
+		/* normalize to [0x40000000, 0x7fffffff] */
+		xn = _mm256_slli_epi32(x, 17);
+		m = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x08000000), xn);
+		xn = _mm256_blendv_epi8(xn, _mm256_slli_epi32(xn, 4), m);
+		sh = _mm256_and_si256(m, _mm256_set1_epi32(4));
+		m = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x20000000), xn);
+		xn = _mm256_blendv_epi8(xn, _mm256_slli_epi32(xn, 2), m);
+		sh = _mm256_add_epi32(sh, _mm256_and_si256(m, _mm256_set1_epi32(2)));
+		m = _mm256_cmpgt_epi32(_mm256_set1_epi32(0x40000000), xn);
+		xn = _mm256_blendv_epi8(xn, _mm256_slli_epi32(xn, 1), m);
+		sh = _mm256_add_epi32(sh, _mm256_and_si256(m, _mm256_set1_epi32(1)));
+
+		/* polynomial, with lo or hi coefs per lane */
+		m = _mm256_cmpgt_epi32(_mm256_set1_epi32(SQRTHALF), xn);
+		yp = _mm256_blendv_epi8(_mm256_set1_epi32(poly43hi[0]), _mm256_set1_epi32(poly43lo[0]), m);
+		for (k = 1; k < 5; k++)
+			yp = _mm256_add_epi32(MulShift32AVX(yp, xn), _mm256_blendv_epi8(_mm256_set1_epi32(poly43hi[k]), _mm256_set1_epi32(poly43lo[k]), m));
+		yp = _mm256_slli_epi32(MulShift32AVX(yp, _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)pow2frac), sh)), 3);
+
+		/* fractional scale */
+		yp = MulShift32AVX(yp, _mm256_set1_epi32(scalef));
+		y = _mm256_blendv_epi8(y, yp, isPoly);
+		shift = _mm256_blendv_epi8(shift, _mm256_sub_epi32(_mm256_set1_epi32(scalei), 
+			_mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)pow2exp), sh)), isPoly);
+	}
+
+	/* integer scale - left shift with clip if shift < 0, otherwise right shift */
+	ls = _mm256_sub_epi32(_mm256_setzero_si256(), shift);
+	maxPos = _mm256_set1_epi32(0x7fffffff);
+	clip = _mm256_cmpgt_epi32(y, _mm256_srlv_epi32(maxPos, ls));
+	yp = _mm256_blendv_epi8(_mm256_sllv_epi32(y, ls), maxPos, clip);
+	y = _mm256_srav_epi32(y, shift);
+
+	return _mm256_blendv_epi8(y, yp, _mm256_cmpgt_epi32(_mm256_setzero_si256(), shift));
+}
+
+/**************************************************************************************
+ * Function:    DequantBlockAVX2
+ *
+ * Description: DequantBlock() from dqchan.c, 8 samples at a time
+ *
+ * Inputs:      input buffer of decode Huffman codewords (signed-magnitude)
+ *              output buffer of same length (in-place (outbuf = inbuf) is allowed)
+ *              number of samples
+ *              scale (gainI)
+ *
+ * Outputs:     dequantized samples in Q25 format
+ *
+ * Return:      bitwise-OR of the unsigned outputs (for guard bit calculations)
+ *
+ * Notes:       last partial group of 8 uses masked loads and stores, so never touches
+ *                samples past inbuf[num-1] or outbuf[num-1]
+ **************************************************************************************/
+__attribute__((target("avx2")))
+int DequantBlockAVX2(int *inbuf, int *outbuf, int num, int scale)
+{
+	int i, scalef, scalei, shift;
+	const int *tab16;
+	__m256i tabLo, tabHi, tab48[6], sx, x, y, sign, lanes, valid, big, mask;
+	__m128i shift4, shiftL, shiftR;
+
+	tab16 = pow43_14[scale & 0x3];
+	scalef = pow14[scale & 0x3];
+	scalei = MIN(scale >> 2, 31);	/* smallest input scale = -47, so smallest scalei = -12 */
+
+	/* x < 4 uses the same table, with a fixed shift (tab4[] in DequantBlock()) */
+	shift = MIN(scalei + 3, 31);
+	shift = MAX(shift, 0);
+	shift4 = _mm_cvtsi32_si128(shift);
+
+	/* 4 <= x < 16 - one of these is 0 */
+	shiftL = _mm_cvtsi32_si128(scalei < 0 ? -scalei : 0);
+	shiftR = _mm_cvtsi32_si128(scalei < 0 ? 0 : scalei);
+
+	tabLo = _mm256_loadu_si256((const __m256i *)(tab16 + 0));
+	tabHi = _mm256_loadu_si256((const __m256i *)(tab16 + 8));
+	for (i = 0; i < 6; i++)
+		tab48[i] = _mm256_loadu_si256((const __m256i *)(pow43 + 8*i));
+	lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	mask = _mm256_setzero_si256();
+
+	for (i = 0; i < num; i += 8) {
+		valid = _mm256_cmpgt_epi32(_mm256_set1_epi32(num - i), lanes);
+		sx = _mm256_maskload_epi32(inbuf + i, valid);
+		x = _mm256_and_si256(sx, _mm256_set1_epi32(0x7fffffff));	/* sx = sign|mag */
+
+		/* x < 16 */
+		y = _mm256_blendv_epi8(_mm256_permutevar8x32_epi32(tabLo, x), _mm256_permutevar8x32_epi32(tabHi, x), 
+			_mm256_cmpgt_epi32(x, _mm256_set1_epi32(7)));
+		y = _mm256_blendv_epi8(_mm256_sra_epi32(_mm256_sll_epi32(y, shiftL), shiftR), _mm256_sra_epi32(y, shift4), 
+			_mm256_cmpgt_epi32(_mm256_set1_epi32(4), x));
+
+		/* x >= 16 */
+		big = _mm256_cmpgt_epi32(x, _mm256_set1_epi32(15));
+		if (!_mm256_testz_si256(big, big))
+			y = _mm256_blendv_epi8(y, Pow43LargeAVX2(x, tab48, scalef, scalei), big);
+
+		/* sign and store */
+		mask = _mm256_or_si256(mask, y);
+		sign = _mm256_srai_epi32(sx, 31);
+		_mm256_maskstore_epi32(outbuf + i, valid, _mm256_sub_epi32(_mm256_xor_si256(y, sign), sign));
+	}
+
+	return HorOrAVX(mask);
+}
+
+#endif	/* HELIX_X86_SIMD */
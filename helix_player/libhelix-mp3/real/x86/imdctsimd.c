@@ -0,0 +1,164 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * imdctsimd.c - SSE4.1 and AVX2 long block IMDCT, 4 or 8 subbands at a time, 
+ *                 plus antialias and frequency inversion
+ *
+ * HybridTransform() in imdct.c calls these for runs of adjacent long blocks which
+ *   share the same current and previous window types (all long blocks, except at
+ *   mixed block or window switch boundaries). Each SIMD lane handles one subband,
+ *   so the output rows (y[i][sb], y[i][sb+1], ...) are contiguous and the only
+ *   transposes are on the input coefficients and the 9 overlap samples.
+ * Short blocks (IMDCT12x3) are rare in practice and stay scalar.
+ * FreqInvertRescale() runs once per granule on the same rows, and AntiAlias() 
+ *   does the 8 butterflies at each block boundary in one (AVX2) or two (SSE4.1) steps.
+ *
+ * Selected at run time in IMDCT(), based on the CPU flags from GetSIMDCaps()
+ **************************************************************************************/
+
+#include "../coder.h"
+#include "../assembly.h"
+
+#ifdef HELIX_X86_SIMD
+
+#include "simdx86.h"
+
+/**************************************************************************************
+ * SSE4.1 - 4 subbands
+ **************************************************************************************/
+#define V					__m128i
+#define VLANES				4
+#define VNAME(f)			f##SSE41
+#define VTARGET				__attribute__((target("sse4.1")))
+#define VZERO				_mm_setzero_si128()
+#define VSET1(c)			_mm_set1_epi32(c)
+#define VADD(a, b)			_mm_add_epi32(a, b)
+#define VSUB(a, b)			_mm_sub_epi32(a, b)
+#define VOR(a, b)			_mm_or_si128(a, b)
+#define VXOR(a, b)			_mm_xor_si128(a, b)
+#define VABS(a)				_mm_abs_epi32(a)
+#define VSRAI(a, n)			_mm_srai_epi32(a, n)
+#define VSLLI(a, n)			_mm_slli_epi32(a, n)
+#define VSRA(a, n)			_mm_sra_epi32(a, n)
+#define VSLL(a, n)			_mm_sll_epi32(a, n)
+#define VMULSHIFT32(a, b)	MulShift32SSE(a, b)
+#define VCLIP2N(a, n)		Clip2NSSE(a, n)
+#define VHOR(a)				HorOrSSE(a)
+#define VSTOREU(p, a)		_mm_storeu_si128((__m128i *)(p), a)
+#define VLOADCOL(p, s)		_mm_setr_epi32((p)[0], (p)[s], (p)[2*(s)], (p)[3*(s)])
+#define VSTORECOL(p, s, a) { \
+	(p)[0]     = _mm_cvtsi128_si32(a);		(p)[s]     = _mm_extract_epi32(a, 1); \
+	(p)[2*(s)] = _mm_extract_epi32(a, 2);	(p)[3*(s)] = _mm_extract_epi32(a, 3); \
+}
+#define VODDMASK(i)			((i) & 0x01 ? _mm_setr_epi32(-1, 0, -1, 0) : _mm_setr_epi32(0, -1, 0, -1))
+#define VAND(a, b)			_mm_and_si128(a, b)
+#define VLOADU(p)			_mm_loadu_si128((const __m128i *)(p))
+#define VBLEND(a, b, m)		_mm_blendv_epi8(a, b, m)
+#define VLANEMASK(n)		_mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 1, 2, 3))
+#define VREVERSE(a)			_mm_shuffle_epi32(a, _MM_SHUFFLE(0,1,2,3))
+
+#include "imdctvec.h"
+
+#undef V
+#undef VLANES
+#undef VNAME
+#undef VTARGET
+#undef VZERO
+#undef VSET1
+#undef VADD
+#undef VSUB
+#undef VOR
+#undef VXOR
+#undef VABS
+#undef VSRAI
+#undef VSLLI
+#undef VSRA
+#undef VSLL
+#undef VMULSHIFT32
+#undef VCLIP2N
+#undef VHOR
+#undef VSTOREU
+#undef VLOADCOL
+#undef VSTORECOL
+#undef VODDMASK
+#undef VAND
+#undef VLOADU
+#undef VBLEND
+#undef VLANEMASK
+#undef VREVERSE
+
+/**************************************************************************************
+ * AVX2 - 8 subbands
+ **************************************************************************************/
+#define V					__m256i
+#define VLANES				8
+#define VNAME(f)			f##AVX2
+#define VTARGET				__attribute__((target("avx2")))
+#define VZERO				_mm256_setzero_si256()
+#define VSET1(c)			_mm256_set1_epi32(c)
+#define VADD(a, b)			_mm256_add_epi32(a, b)
+#define VSUB(a, b)			_mm256_sub_epi32(a, b)
+#define VOR(a, b)			_mm256_or_si256(a, b)
+#define VXOR(a, b)			_mm256_xor_si256(a, b)
+#define VABS(a)				_mm256_abs_epi32(a)
+#define VSRAI(a, n)			_mm256_srai_epi32(a, n)
+#define VSLLI(a, n)			_mm256_slli_epi32(a, n)
+#define VSRA(a, n)			_mm256_sra_epi32(a, n)
+#define VSLL(a, n)			_mm256_sll_epi32(a, n)
+#define VMULSHIFT32(a, b)	MulShift32AVX(a, b)
+#define VCLIP2N(a, n)		Clip2NAVX(a, n)
+#define VHOR(a)				HorOrAVX(a)
+#define VSTOREU(p, a)		_mm256_storeu_si256((__m256i *)(p), a)
+#define VLOADCOL(p, s)		_mm256_i32gather_epi32((p), _mm256_setr_epi32(0, s, 2*(s), 3*(s), 4*(s), 5*(s), 6*(s), 7*(s)), 4)
+#define VSTORECOL(p, s, a) { \
+	int k_, t_[8]; \
+	_mm256_storeu_si256((__m256i *)t_, a); \
+	for (k_ = 0; k_ < 8; k_++) \
+		(p)[k_*(s)] = t_[k_]; \
+}
+#define VODDMASK(i)			((i) & 0x01 ? _mm256_setr_epi32(-1, 0, -1, 0, -1, 0, -1, 0) : _mm256_setr_epi32(0, -1, 0, -1, 0, -1, 0, -1))
+#define VAND(a, b)			_mm256_and_si256(a, b)
+#define VLOADU(p)			_mm256_loadu_si256((const __m256i *)(p))
+#define VBLEND(a, b, m)		_mm256_blendv_epi8(a, b, m)
+#define VLANEMASK(n)		_mm256_cmpgt_epi32(_mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7))
+#define VREVERSE(a)			_mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0))
+
+#include "imdctvec.h"
+
+#endif	/* HELIX_X86_SIMD */
@@ -0,0 +1,343 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * imdctvec.h - long block IMDCT (IMDCT36 + WinPrevious + overlap-add + frequency 
+ *                inversion) on several subbands at once, one subband per SIMD lane
+ *
+ * This is a code template - imdctsimd.c includes it once per instruction set, after
+ *   defining the vector type and operations (V, VLANES, VNAME, VTARGET, VADD, etc.)
+ * Every operation mirrors the scalar code in imdct.c, so the output is bit-exact.
+ **************************************************************************************/
+
+/* 9-point IDCT on each lane, see idct9() in imdct.c */
+VTARGET static __inline void VNAME(IDCT9)(V *x)
+{
+	V a1, a2, a3, a4, a5, a6, a7, a8, a9;
+	V a10, a11, a12, a13, a14, a15, a16, a17, a18;
+	V a19, a20, a21, a22, a23, a24, a25, a26, a27;
+	V m1, m3, m5, m6, m7, m8, m9, m10, m11, m12;
+	V x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+	x0 = x[0]; x1 = x[1]; x2 = x[2]; x3 = x[3]; x4 = x[4];
+	x5 = x[5]; x6 = x[6]; x7 = x[7]; x8 = x[8];
+
+	a1 = VSUB(x0, x6);
+	a2 = VSUB(x1, x5);
+	a3 = VADD(x1, x5);
+	a4 = VSUB(x2, x4);
+	a5 = VADD(x2, x4);
+	a6 = VADD(x2, x8);
+	a7 = VADD(x1, x7);
+
+	a8 = VSUB(a6, a5);
+	a9 = VSUB(a3, a7);
+	a10 = VSUB(a2, x7);
+	a11 = VSUB(a4, x8);
+
+	m1 =  VMULSHIFT32(VSET1(c9_0), x3);
+	m3 =  VMULSHIFT32(VSET1(c9_0), a10);
+	m5 =  VMULSHIFT32(VSET1(c9_1), a5);
+	m6 =  VMULSHIFT32(VSET1(c9_2), a6);
+	m7 =  VMULSHIFT32(VSET1(c9_1), a8);
+	m8 =  VMULSHIFT32(VSET1(c9_2), a5);
+	m9 =  VMULSHIFT32(VSET1(c9_3), a9);
+	m10 = VMULSHIFT32(VSET1(c9_4), a7);
+	m11 = VMULSHIFT32(VSET1(c9_3), a3);
+	m12 = VMULSHIFT32(VSET1(c9_4), a9);
+
+	a12 = VADD(x0, VSRAI(x6, 1));
+	a13 = VADD(a12, VSLLI(m1, 1));
+	a14 = VSUB(a12, VSLLI(m1, 1));
+	a15 = VADD(a1, VSRAI(a11, 1));
+	a16 = VADD(VSLLI(m5, 1), VSLLI(m6, 1));
+	a17 = VSUB(VSLLI(m7, 1), VSLLI(m8, 1));
+	a18 = VADD(a16, a17);
+	a19 = VADD(VSLLI(m9, 1), VSLLI(m10, 1));
+	a20 = VSUB(VSLLI(m11, 1), VSLLI(m12, 1));
+
+	a21 = VSUB(a20, a19);
+	a22 = VADD(a13, a16);
+	a23 = VADD(a14, a16);
+	a24 = VADD(a14, a17);
+	a25 = VADD(a13, a17);
+	a26 = VSUB(a14, a18);
+	a27 = VSUB(a13, a18);
+
+	x[0] = VADD(a22, a19);
+	x[1] = VADD(a15, VSLLI(m3, 1));
+	x[2] = VADD(a24, a20);
+	x[3] = VSUB(a26, a21);
+	x[4] = VSUB(a1, a11);
+	x[5] = VADD(a27, a21);
+	x[6] = VSUB(a25, a20);
+	x[7] = VSUB(a15, VSLLI(m3, 1));
+	x[8] = VSUB(a23, a19);
+}
+
+/* windowing of the previous block's overlap, see WinPrevious() in imdct.c */
+VTARGET static __inline void VNAME(WinPrevious)(V *xPrev, V *xPrevWin, int btPrev)
+{
+	int i;
+	const int *wpLo;
+
+	if (btPrev == 2) {
+		wpLo = imdctWin[btPrev];
+		xPrevWin[ 0] = VADD(VMULSHIFT32(VSET1(wpLo[ 6]), xPrev[2]), VMULSHIFT32(VSET1(wpLo[0]), xPrev[6]));
+		xPrevWin[ 1] = VADD(VMULSHIFT32(VSET1(wpLo[ 7]), xPrev[1]), VMULSHIFT32(VSET1(wpLo[1]), xPrev[7]));
+		xPrevWin[ 2] = VADD(VMULSHIFT32(VSET1(wpLo[ 8]), xPrev[0]), VMULSHIFT32(VSET1(wpLo[2]), xPrev[8]));
+		xPrevWin[ 3] = VADD(VMULSHIFT32(VSET1(wpLo[ 9]), xPrev[0]), VMULSHIFT32(VSET1(wpLo[3]), xPrev[8]));
+		xPrevWin[ 4] = VADD(VMULSHIFT32(VSET1(wpLo[10]), xPrev[1]), VMULSHIFT32(VSET1(wpLo[4]), xPrev[7]));
+		xPrevWin[ 5] = VADD(VMULSHIFT32(VSET1(wpLo[11]), xPrev[2]), VMULSHIFT32(VSET1(wpLo[5]), xPrev[6]));
+		xPrevWin[ 6] = VMULSHIFT32(VSET1(wpLo[ 6]), xPrev[5]);
+		xPrevWin[ 7] = VMULSHIFT32(VSET1(wpLo[ 7]), xPrev[4]);
+		xPrevWin[ 8] = VMULSHIFT32(VSET1(wpLo[ 8]), xPrev[3]);
+		xPrevWin[ 9] = VMULSHIFT32(VSET1(wpLo[ 9]), xPrev[3]);
+		xPrevWin[10] = VMULSHIFT32(VSET1(wpLo[10]), xPrev[4]);
+		xPrevWin[11] = VMULSHIFT32(VSET1(wpLo[11]), xPrev[5]);
+		for (i = 12; i < 18; i++)
+			xPrevWin[i] = VZERO;
+	} else {
+		wpLo = imdctWin[btPrev] + 18;
+		for (i = 0; i < 9; i++) {
+			xPrevWin[i]    = VMULSHIFT32(VSET1(wpLo[i]),      xPrev[i]);
+			xPrevWin[17-i] = VMULSHIFT32(VSET1(wpLo[17 - i]), xPrev[i]);
+		}
+	}
+}
+
+/**************************************************************************************
+ * Function:    IMDCT36xN (N = VLANES)
+ *
+ * Description: IMDCT36() from imdct.c for N adjacent long blocks which all use the 
+ *                same window types
+ *
+ * Inputs:      N * 18 input coefficients (block i at xCurr + 18*i)
+ *              N * 9 overlap samples from last IMDCT (block i at xPrev + 9*i)
+ *              output pointer for the first block (&y[0][blockIdx])
+ *              window type of current and previous blocks
+ *              number of guard bits in input vector
+ *
+ * Outputs:     18 * N output samples (rows of y, NBANDS apart)
+ *              updated overlap samples
+ *              both still need FreqInvertRescale(), as for IMDCT36()
+ *
+ * Return:      mOut (OR of abs(y) for all y calculated here, same as the scalar code)
+ **************************************************************************************/
+VTARGET int VNAME(IMDCT36x)(int *xCurr, int *xPrev, int *y, int btCurr, int btPrev, int gb)
+{
+	int i, es;
+	const int *wp;
+	V xBuf[18], xp[9], xPrevWin[18];
+	V acc1, acc2, xo, xe, s, d, t, yLo, yHi, mOut;
+	__m128i esv;
+
+	es = 0;
+	if (gb < 7)
+		es = 7 - gb;
+	esv = _mm_cvtsi32_si128(es);
+
+	/* transpose into one block per lane, with pre-scaling (es = 0 unless gb < 7) */
+	acc1 = acc2 = VZERO;
+	for (i = 8; i >= 0; i--) {
+		acc1 = VSUB(VSRA(VLOADCOL(xCurr + 2*i + 1, 18), esv), acc1);
+		acc2 = VSUB(acc1, acc2);
+		acc1 = VSUB(VSRA(VLOADCOL(xCurr + 2*i + 0, 18), esv), acc1);
+		xBuf[i+9] = acc2;
+		xBuf[i+0] = acc1;
+	}
+	for (i = 0; i < 9; i++)
+		xp[i] = VSRA(VLOADCOL(xPrev + i, 9), esv);
+
+	xBuf[9] = VSRAI(xBuf[9], 1);
+	xBuf[0] = VSRAI(xBuf[0], 1);
+
+	VNAME(IDCT9)(xBuf + 0);
+	VNAME(IDCT9)(xBuf + 9);
+
+	mOut = VZERO;
+
+#define VSTOREY(row, v) { \
+	mOut = VOR(mOut, VABS(v)); \
+	VSTOREU(y + (row)*NBANDS, v); \
+}
+
+	if (btPrev == 0 && btCurr == 0) {
+		/* fast path - symmetric sin window */
+		for (i = 0; i < 9; i++) {
+			xo = VMULSHIFT32(VSET1(c18[8-i]), xBuf[17-i]);
+			xe = VSRAI(xBuf[8-i], 2);
+
+			s = VSUB(VZERO, xp[i]);
+			d = VSUB(xo, xe);
+			xp[i] = VADD(xe, xo);
+			t = VSUB(s, d);
+
+			yLo = VADD(d, VSLLI(VMULSHIFT32(t, VSET1(fastWin36[2*i+0])), 2));
+			yHi = VADD(s, VSLLI(VMULSHIFT32(t, VSET1(fastWin36[2*i+1])), 2));
+			VSTOREY(i, yLo);
+			VSTOREY(17-i, yHi);
+		}
+	} else {
+		/* full 36-point window */
+		VNAME(WinPrevious)(xp, xPrevWin, btPrev);
+
+		wp = imdctWin[btCurr];
+		for (i = 0; i < 9; i++) {
+			xo = VMULSHIFT32(VSET1(c18[8-i]), xBuf[17-i]);
+			xe = VSRAI(xBuf[8-i], 2);
+
+			d = VSUB(xe, xo);
+			xp[i] = VADD(xe, xo);
+
+			yLo = VSLLI(VADD(xPrevWin[i],    VMULSHIFT32(d, VSET1(wp[i]))), 2);
+			yHi = VSLLI(VADD(xPrevWin[17-i], VMULSHIFT32(d, VSET1(wp[17-i]))), 2);
+			VSTOREY(i, yLo);
+			VSTOREY(17-i, yHi);
+		}
+	}
+#undef VSTOREY
+
+	/* store the overlap back (one block per lane) */
+	for (i = 0; i < 9; i++)
+		VSTORECOL(xPrev + i, 9, xp[i]);
+
+	return VHOR(mOut);
+}
+
+/**************************************************************************************
+ * Function:    FreqInvertRescaleN (N = VLANES)
+ *
+ * Description: FreqInvertRescale() from imdct.c, N blocks (one row segment of y) 
+ *                at a time
+ *
+ * Inputs:      output buffer y, after all the IMDCT's for this granule
+ *              overlap samples for all blocks (9 per block, contiguous)
+ *              number of blocks calculated
+ *              number of extra shifts added before IMDCT
+ *
+ * Outputs:     inverted and rescaled (as necessary) outputs and overlap samples
+ *
+ * Return:      updated mOut (from new outputs y)
+ *
+ * Notes:       lanes at or above nBlocks are loaded and stored back unchanged
+ **************************************************************************************/
+VTARGET int VNAME(FreqInvertRescale)(int y[BLOCK_SIZE][NBANDS], int *xPrev, int nBlocks, int es)
+{
+	int i, j, d;
+	V yy, valid, fiMask, mOut;
+	__m128i esv;
+
+	if (es == 0) {
+		/* fast case - frequency invert only (no rescaling) */
+		for (i = 0; i < nBlocks; i += VLANES) {
+			fiMask = VAND(VODDMASK(0), VLANEMASK(nBlocks - i));
+			for (j = 1; j < BLOCK_SIZE; j += 2) {
+				yy = VLOADU(&y[j][i]);
+				VSTOREU(&y[j][i], VSUB(VXOR(yy, fiMask), fiMask));
+			}
+		}
+		return 0;
+	}
+
+	/* undo pre-IMDCT scaling, clipping if necessary */
+	esv = _mm_cvtsi32_si128(es);
+	mOut = VZERO;
+	for (i = 0; i < nBlocks; i += VLANES) {
+		valid = VLANEMASK(nBlocks - i);
+		fiMask = VAND(VODDMASK(0), valid);
+		for (j = 0; j < BLOCK_SIZE; j++) {
+			yy = VLOADU(&y[j][i]);
+			if (j & 0x01)
+				yy = VSUB(VXOR(yy, fiMask), fiMask);
+			yy = VBLEND(yy, VSLL(VCLIP2N(yy, 31 - es), esv), valid);
+			mOut = VOR(mOut, VAND(VABS(yy), valid));
+			VSTOREU(&y[j][i], yy);
+		}
+	}
+
+	for (i = 0; i + VLANES <= 9*nBlocks; i += VLANES) {
+		yy = VLOADU(xPrev + i);
+		VSTOREU(xPrev + i, VSLL(VCLIP2N(yy, 31 - es), esv));
+	}
+	for (   ; i < 9*nBlocks; i++) {
+		d = xPrev[i];	CLIP_2N(d, 31 - es);	xPrev[i] = d << es;
+	}
+
+	return VHOR(mOut);
+}
+
+/**************************************************************************************
+ * Function:    AntiAliasN (N = VLANES)
+ *
+ * Description: AntiAlias() from imdct.c, N butterflies at a time
+ *
+ * Inputs:      vector of dequantized coefficients, length = (nBfly+1) * 18
+ *              number of block boundaries to smooth
+ *
+ * Outputs:     updated coefficient vector x
+ *
+ * Return:      none
+ *
+ * Notes:       the 8 samples below each boundary are reversed into lane order, so 
+ *                lane k of a and b holds the pair (x[-1-k], x[k]) for csa[k]
+ **************************************************************************************/
+VTARGET void VNAME(AntiAlias)(int *x, int nBfly)
+{
+	int j, k, cs[2][8];
+	V a, b, c0[8/VLANES], c1[8/VLANES];
+
+	for (k = 0; k < 8; k++) {
+		cs[0][k] = csa[k][0];
+		cs[1][k] = csa[k][1];
+	}
+	for (j = 0; j < 8/VLANES; j++) {
+		c0[j] = VLOADU(cs[0] + j*VLANES);
+		c1[j] = VLOADU(cs[1] + j*VLANES);
+	}
+
+	for (k = nBfly; k > 0; k--) {
+		x += 18;
+		for (j = 0; j < 8/VLANES; j++) {
+			a = VREVERSE(VLOADU(x - (j+1)*VLANES));
+			b = VLOADU(x + j*VLANES);
+			VSTOREU(x - (j+1)*VLANES, VREVERSE(VSLLI(VSUB(VMULSHIFT32(a, c0[j]), VMULSHIFT32(b, c1[j])), 1)));
+			VSTOREU(x + j*VLANES, VSLLI(VADD(VMULSHIFT32(b, c0[j]), VMULSHIFT32(a, c1[j])), 1));
+		}
+	}
+}
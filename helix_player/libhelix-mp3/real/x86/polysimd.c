@@ -0,0 +1,391 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * polysimd.c - SSE4.1 and AVX2 versions of the polyphase synthesis filter
+ *
+ * These produce exactly the same output as the C reference version in polyphase.c.
+ * The 64-bit multiply-accumulates are done with packed signed 32x32 -> 64 multiplies
+ *   (pmuldq), which only read the low 32 bits of each 64-bit lane, so all sums are 
+ *   exact and the order of accumulation does not matter.
+ * The final (int)SAR64() + ClipToShort() maps onto a logical 64-bit shift (only the low 
+ *   32 bits of the result are kept), an arithmetic 32-bit shift, and a saturating pack.
+ *
+ * Selected at run time in Subband(), based on the CPU flags from GetSIMDCaps()
+ **************************************************************************************/
+
+#include "../coder.h"
+
+#ifdef HELIX_X86_SIMD
+
+#include <immintrin.h>
+
+/* must match polyphase.c */
+#define DEF_NFRACBITS	(DQ_FRACBITS_OUT - 2 - 2 - 15)
+#define CSHIFT	12
+#define RND_VAL	(1 << (DEF_NFRACBITS - 1 + (32 - CSHIFT)))
+
+/**************************************************************************************
+ * SSE4.1 - two 64-bit accumulators per register
+ *
+ * vbuf and coef are loaded 4 at a time, then pshufd moves the two values we want into
+ *   the even 32-bit slots that pmuldq reads (odd slots are don't-cares)
+ * coefs are stored as (c1, c2) pairs, so the low half of each 64-bit lane is c1 and
+ *   a 32-bit right shift of the lane gives c2
+ **************************************************************************************/
+
+#define LO01	_MM_SHUFFLE(1,1,0,0)	/* v[0], v[1] */
+#define LO23	_MM_SHUFFLE(3,3,2,2)	/* v[2], v[3] */
+#define HI01	_MM_SHUFFLE(2,2,3,3)	/* v[3], v[2] - taps 23-x run backwards */
+#define HI23	_MM_SHUFFLE(0,0,1,1)	/* v[1], v[0] */
+
+/* sum1 += vLo*c1 - vHi*c2, sum2 += vLo*c2 + vHi*c1, for 8 taps of one channel */
+#define MC2SSE(vb, sum1, sum2) { \
+	__m128i vl, vh, l0, l1, l2, l3, h0, h1, h2, h3; \
+	vl = _mm_loadu_si128((const __m128i *)((vb) +  0));	vh = _mm_loadu_si128((const __m128i *)((vb) + 20)); \
+	l0 = _mm_shuffle_epi32(vl, LO01);	l1 = _mm_shuffle_epi32(vl, LO23); \
+	h0 = _mm_shuffle_epi32(vh, HI01);	h1 = _mm_shuffle_epi32(vh, HI23); \
+	vl = _mm_loadu_si128((const __m128i *)((vb) +  4));	vh = _mm_loadu_si128((const __m128i *)((vb) + 16)); \
+	l2 = _mm_shuffle_epi32(vl, LO01);	l3 = _mm_shuffle_epi32(vl, LO23); \
+	h2 = _mm_shuffle_epi32(vh, HI01);	h3 = _mm_shuffle_epi32(vh, HI23); \
+	sum1 = _mm_add_epi64(_mm_add_epi64(_mm_mul_epi32(l0, c0), _mm_mul_epi32(l1, c1)), _mm_add_epi64(_mm_mul_epi32(l2, c2), _mm_mul_epi32(l3, c3))); \
+	sum1 = _mm_sub_epi64(sum1, _mm_add_epi64(_mm_add_epi64(_mm_mul_epi32(h0, d0), _mm_mul_epi32(h1, d1)), _mm_add_epi64(_mm_mul_epi32(h2, d2), _mm_mul_epi32(h3, d3)))); \
+	sum2 = _mm_add_epi64(_mm_add_epi64(_mm_mul_epi32(l0, d0), _mm_mul_epi32(l1, d1)), _mm_add_epi64(_mm_mul_epi32(l2, d2), _mm_mul_epi32(l3, d3))); \
+	sum2 = _mm_add_epi64(sum2,  _mm_add_epi64(_mm_add_epi64(_mm_mul_epi32(h0, c0), _mm_mul_epi32(h1, c1)), _mm_add_epi64(_mm_mul_epi32(h2, c2), _mm_mul_epi32(h3, c3)))); \
+}
+
+/* sum1 += v*c for 8 taps (single coefficients, used for sample 16) */
+#define MC1SSE(vb, sum1) { \
+	__m128i vl, l0, l1, l2, l3; \
+	vl = _mm_loadu_si128((const __m128i *)((vb) + 0)); \
+	l0 = _mm_shuffle_epi32(vl, LO01);	l1 = _mm_shuffle_epi32(vl, LO23); \
+	vl = _mm_loadu_si128((const __m128i *)((vb) + 4)); \
+	l2 = _mm_shuffle_epi32(vl, LO01);	l3 = _mm_shuffle_epi32(vl, LO23); \
+	sum1 = _mm_add_epi64(_mm_add_epi64(_mm_mul_epi32(l0, c0), _mm_mul_epi32(l1, c1)), _mm_add_epi64(_mm_mul_epi32(l2, c2), _mm_mul_epi32(l3, c3))); \
+}
+
+/* load 8 (c1, c2) coefficient pairs */
+#define LOADC2SSE(coef) { \
+	c0 = _mm_loadu_si128((const __m128i *)((coef) +  0));	d0 = _mm_srli_epi64(c0, 32); \
+	c1 = _mm_loadu_si128((const __m128i *)((coef) +  4));	d1 = _mm_srli_epi64(c1, 32); \
+	c2 = _mm_loadu_si128((const __m128i *)((coef) +  8));	d2 = _mm_srli_epi64(c2, 32); \
+	c3 = _mm_loadu_si128((const __m128i *)((coef) + 12));	d3 = _mm_srli_epi64(c3, 32); \
+}
+
+/* load 8 single coefficients */
+#define LOADC1SSE(coef) { \
+	c0 = _mm_loadu_si128((const __m128i *)((coef) + 0));	c1 = _mm_shuffle_epi32(c0, LO23);	c0 = _mm_shuffle_epi32(c0, LO01); \
+	c2 = _mm_loadu_si128((const __m128i *)((coef) + 4));	c3 = _mm_shuffle_epi32(c2, LO23);	c2 = _mm_shuffle_epi32(c2, LO01); \
+}
+
+/* horizontal sums of a, b, c, d -> rounded, shifted, and clipped to 4 shorts (low 64 bits) */
+__attribute__((target("sse4.1")))
+static __inline __m128i RoundClipSSE(__m128i a, __m128i b, __m128i c, __m128i d)
+{
+	__m128i ab, cd;
+
+	ab = _mm_add_epi64(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+	cd = _mm_add_epi64(_mm_unpacklo_epi64(c, d), _mm_unpackhi_epi64(c, d));
+	ab = _mm_srli_epi64(_mm_add_epi64(ab, _mm_set1_epi64x(RND_VAL)), 32 - CSHIFT);
+	cd = _mm_srli_epi64(_mm_add_epi64(cd, _mm_set1_epi64x(RND_VAL)), 32 - CSHIFT);
+	ab = _mm_unpacklo_epi64(_mm_shuffle_epi32(ab, _MM_SHUFFLE(3,1,2,0)), _mm_shuffle_epi32(cd, _MM_SHUFFLE(3,1,2,0)));
+	ab = _mm_srai_epi32(ab, DEF_NFRACBITS);
+
+	return _mm_packs_epi32(ab, ab);
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseMonoSSE41
+ *
+ * Description: SSE4.1 version of PolyphaseMono() (see polyphase.c)
+ **************************************************************************************/
+__attribute__((target("sse4.1")))
+void PolyphaseMonoSSE41(short *pcm, int *vbuf, const int *coefBase)
+{
+	int i;
+	const int *coef;
+	int *vb1;
+	__m128i c0, c1, c2, c3, d0, d1, d2, d3;
+	__m128i sum1L, sum2L, zero, x;
+
+	zero = _mm_setzero_si128();
+
+	/* special case, output sample 0 */
+	LOADC2SSE(coefBase);
+	MC2SSE(vbuf, sum1L, sum2L);
+
+	/* special case, output sample 16 */
+	LOADC1SSE(coefBase + 256);
+	MC1SSE(vbuf + 64*16, sum2L);
+
+	x = RoundClipSSE(sum1L, sum2L, zero, zero);
+	pcm[0]  = (short)_mm_extract_epi16(x, 0);
+	pcm[16] = (short)_mm_extract_epi16(x, 1);
+
+	/* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
+	coef = coefBase + 16;
+	vb1 = vbuf + 64;
+	pcm++;
+
+	for (i = 15; i > 0; i--) {
+		LOADC2SSE(coef);
+		MC2SSE(vb1, sum1L, sum2L);
+
+		x = RoundClipSSE(sum1L, sum2L, zero, zero);
+		pcm[0]   = (short)_mm_extract_epi16(x, 0);
+		pcm[2*i] = (short)_mm_extract_epi16(x, 1);
+
+		coef += 16;
+		vb1 += 64;
+		pcm++;
+	}
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseStereoSSE41
+ *
+ * Description: SSE4.1 version of PolyphaseStereo() (see polyphase.c)
+ *
+ * Notes:       interleaves PCM samples LRLRLR...
+ **************************************************************************************/
+__attribute__((target("sse4.1")))
+void PolyphaseStereoSSE41(short *pcm, int *vbuf, const int *coefBase)
+{
+	int i;
+	const int *coef;
+	int *vb1;
+	__m128i c0, c1, c2, c3, d0, d1, d2, d3;
+	__m128i sum1L, sum2L, sum1R, sum2R, x;
+
+	/* special case, output sample 0 (sum2 unused) */
+	LOADC2SSE(coefBase);
+	MC2SSE(vbuf,      sum1L, sum2L);
+	MC2SSE(vbuf + 32, sum1R, sum2R);
+
+	/* special case, output sample 16 */
+	LOADC1SSE(coefBase + 256);
+	MC1SSE(vbuf + 64*16,      sum2L);
+	MC1SSE(vbuf + 64*16 + 32, sum2R);
+
+	x = RoundClipSSE(sum1L, sum1R, sum2L, sum2R);
+	pcm[0]        = (short)_mm_extract_epi16(x, 0);
+	pcm[1]        = (short)_mm_extract_epi16(x, 1);
+	pcm[2*16 + 0] = (short)_mm_extract_epi16(x, 2);
+	pcm[2*16 + 1] = (short)_mm_extract_epi16(x, 3);
+
+	/* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
+	coef = coefBase + 16;
+	vb1 = vbuf + 64;
+	pcm += 2;
+
+	for (i = 15; i > 0; i--) {
+		LOADC2SSE(coef);
+		MC2SSE(vb1,      sum1L, sum2L);
+		MC2SSE(vb1 + 32, sum1R, sum2R);
+
+		x = RoundClipSSE(sum1L, sum1R, sum2L, sum2R);
+		pcm[0]         = (short)_mm_extract_epi16(x, 0);
+		pcm[1]         = (short)_mm_extract_epi16(x, 1);
+		pcm[2*2*i + 0] = (short)_mm_extract_epi16(x, 2);
+		pcm[2*2*i + 1] = (short)_mm_extract_epi16(x, 3);
+
+		coef += 16;
+		vb1 += 64;
+		pcm += 2;
+	}
+}
+
+/**************************************************************************************
+ * AVX2 - four 64-bit accumulators per register
+ *
+ * vbuf is sign-extended to 64-bit lanes with vpmovsxdq (4 taps per register), and 
+ *   coefs are used in place as (c1, c2) pairs, as in the SSE4.1 version
+ **************************************************************************************/
+
+#define REV4	_MM_SHUFFLE(0,1,2,3)
+
+#define MC2AVX(vb, sum1, sum2) { \
+	__m256i l0, l1, h0, h1; \
+	l0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((vb) + 0))); \
+	l1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((vb) + 4))); \
+	h0 = _mm256_cvtepi32_epi64(_mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)((vb) + 20)), REV4)); \
+	h1 = _mm256_cvtepi32_epi64(_mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)((vb) + 16)), REV4)); \
+	sum1 = _mm256_sub_epi64(_mm256_add_epi64(_mm256_mul_epi32(l0, c0), _mm256_mul_epi32(l1, c1)), \
+	                        _mm256_add_epi64(_mm256_mul_epi32(h0, d0), _mm256_mul_epi32(h1, d1))); \
+	sum2 = _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epi32(l0, d0), _mm256_mul_epi32(l1, d1)), \
+	                        _mm256_add_epi64(_mm256_mul_epi32(h0, c0), _mm256_mul_epi32(h1, c1))); \
+}
+
+#define MC1AVX(vb, sum1) { \
+	__m256i l0, l1; \
+	l0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((vb) + 0))); \
+	l1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((vb) + 4))); \
+	sum1 = _mm256_add_epi64(_mm256_mul_epi32(l0, c0), _mm256_mul_epi32(l1, c1)); \
+}
+
+#define LOADC2AVX(coef) { \
+	c0 = _mm256_loadu_si256((const __m256i *)((coef) + 0));	d0 = _mm256_srli_epi64(c0, 32); \
+	c1 = _mm256_loadu_si256((const __m256i *)((coef) + 8));	d1 = _mm256_srli_epi64(c1, 32); \
+}
+
+#define LOADC1AVX(coef) { \
+	c0 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((coef) + 0))); \
+	c1 = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)((coef) + 4))); \
+}
+
+__attribute__((target("avx2")))
+static __inline __m128i RoundClipAVX(__m256i a, __m256i b, __m256i c, __m256i d)
+{
+	__m256i ab, cd;
+	__m128i x;
+
+	/* ab = (a0+a1, b0+b1, a2+a3, b2+b3), cd = (c0+c1, d0+d1, c2+c3, d2+d3) */
+	ab = _mm256_add_epi64(_mm256_unpacklo_epi64(a, b), _mm256_unpackhi_epi64(a, b));
+	cd = _mm256_add_epi64(_mm256_unpacklo_epi64(c, d), _mm256_unpackhi_epi64(c, d));
+	ab = _mm256_add_epi64(_mm256_permute2x128_si256(ab, cd, 0x20), _mm256_permute2x128_si256(ab, cd, 0x31));
+
+	ab = _mm256_srli_epi64(_mm256_add_epi64(ab, _mm256_set1_epi64x(RND_VAL)), 32 - CSHIFT);
+	x = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(ab, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+	x = _mm_srai_epi32(x, DEF_NFRACBITS);
+
+	return _mm_packs_epi32(x, x);
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseMonoAVX2
+ *
+ * Description: AVX2 version of PolyphaseMono() (see polyphase.c)
+ **************************************************************************************/
+__attribute__((target("avx2")))
+void PolyphaseMonoAVX2(short *pcm, int *vbuf, const int *coefBase)
+{
+	int i;
+	const int *coef;
+	int *vb1;
+	__m256i c0, c1, d0, d1;
+	__m256i sum1L, sum2L, zero;
+	__m128i x;
+
+	zero = _mm256_setzero_si256();
+
+	/* special case, output sample 0 */
+	LOADC2AVX(coefBase);
+	MC2AVX(vbuf, sum1L, sum2L);
+
+	/* special case, output sample 16 */
+	LOADC1AVX(coefBase + 256);
+	MC1AVX(vbuf + 64*16, sum2L);
+
+	x = RoundClipAVX(sum1L, sum2L, zero, zero);
+	pcm[0]  = (short)_mm_extract_epi16(x, 0);
+	pcm[16] = (short)_mm_extract_epi16(x, 1);
+
+	/* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
+	coef = coefBase + 16;
+	vb1 = vbuf + 64;
+	pcm++;
+
+	for (i = 15; i > 0; i--) {
+		LOADC2AVX(coef);
+		MC2AVX(vb1, sum1L, sum2L);
+
+		x = RoundClipAVX(sum1L, sum2L, zero, zero);
+		pcm[0]   = (short)_mm_extract_epi16(x, 0);
+		pcm[2*i] = (short)_mm_extract_epi16(x, 1);
+
+		coef += 16;
+		vb1 += 64;
+		pcm++;
+	}
+}
+
+/**************************************************************************************
+ * Function:    PolyphaseStereoAVX2
+ *
+ * Description: AVX2 version of PolyphaseStereo() (see polyphase.c)
+ *
+ * Notes:       interleaves PCM samples LRLRLR...
+ **************************************************************************************/
+__attribute__((target("avx2")))
+void PolyphaseStereoAVX2(short *pcm, int *vbuf, const int *coefBase)
+{
+	int i;
+	const int *coef;
+	int *vb1;
+	__m256i c0, c1, d0, d1;
+	__m256i sum1L, sum2L, sum1R, sum2R;
+	__m128i x;
+
+	/* special case, output sample 0 (sum2 unused) */
+	LOADC2AVX(coefBase);
+	MC2AVX(vbuf,      sum1L, sum2L);
+	MC2AVX(vbuf + 32, sum1R, sum2R);
+
+	/* special case, output sample 16 */
+	LOADC1AVX(coefBase + 256);
+	MC1AVX(vbuf + 64*16,      sum2L);
+	MC1AVX(vbuf + 64*16 + 32, sum2R);
+
+	x = RoundClipAVX(sum1L, sum1R, sum2L, sum2R);
+	pcm[0]        = (short)_mm_extract_epi16(x, 0);
+	pcm[1]        = (short)_mm_extract_epi16(x, 1);
+	pcm[2*16 + 0] = (short)_mm_extract_epi16(x, 2);
+	pcm[2*16 + 1] = (short)_mm_extract_epi16(x, 3);
+
+	/* main convolution loop: sum1L = samples 1, 2, 3, ... 15   sum2L = samples 31, 30, ... 17 */
+	coef = coefBase + 16;
+	vb1 = vbuf + 64;
+	pcm += 2;
+
+	for (i = 15; i > 0; i--) {
+		LOADC2AVX(coef);
+		MC2AVX(vb1,      sum1L, sum2L);
+		MC2AVX(vb1 + 32, sum1R, sum2R);
+
+		x = RoundClipAVX(sum1L, sum1R, sum2L, sum2R);
+		pcm[0]         = (short)_mm_extract_epi16(x, 0);
+		pcm[1]         = (short)_mm_extract_epi16(x, 1);
+		pcm[2*2*i + 0] = (short)_mm_extract_epi16(x, 2);
+		pcm[2*2*i + 1] = (short)_mm_extract_epi16(x, 3);
+
+		coef += 16;
+		vb1 += 64;
+		pcm += 2;
+	}
+}
+
+#endif	/* HELIX_X86_SIMD */
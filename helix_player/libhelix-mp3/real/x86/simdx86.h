@@ -0,0 +1,105 @@
+/* ***** BEGIN LICENSE BLOCK ***** 
+ * Version: RCSL 1.0/RPSL 1.0 
+ *  
+ * Portions Copyright (c) 1995-2002 RealNetworks, Inc. All Rights Reserved. 
+ *      
+ * The contents of this file, and the files included with this file, are 
+ * subject to the current version of the RealNetworks Public Source License 
+ * Version 1.0 (the "RPSL") available at 
+ * http://www.helixcommunity.org/content/rpsl unless you have licensed 
+ * the file under the RealNetworks Community Source License Version 1.0 
+ * (the "RCSL") available at http://www.helixcommunity.org/content/rcsl, 
+ * in which case the RCSL will apply. You may also obtain the license terms 
+ * directly from RealNetworks.  You may not use this file except in 
+ * compliance with the RPSL or, if you have a valid RCSL with RealNetworks 
+ * applicable to this file, the RCSL.  Please see the applicable RPSL or 
+ * RCSL for the rights, obligations and limitations governing use of the 
+ * contents of the file.  
+ *  
+ * This file is part of the Helix DNA Technology. RealNetworks is the 
+ * developer of the Original Code and owns the copyrights in the portions 
+ * it created. 
+ *  
+ * This file, and the files included with this file, is distributed and made 
+ * available on an 'AS IS' basis, WITHOUT WARRANTY OF ANY KIND, EITHER 
+ * EXPRESS OR IMPLIED, AND REALNETWORKS HEREBY DISCLAIMS ALL SUCH WARRANTIES, 
+ * INCLUDING WITHOUT LIMITATION, ANY WARRANTIES OF MERCHANTABILITY, FITNESS 
+ * FOR A PARTICULAR PURPOSE, QUIET ENJOYMENT OR NON-INFRINGEMENT. 
+ * 
+ * Technology Compatibility Kit Test Suite(s) Location: 
+ *    http://www.helixcommunity.org/content/tck 
+ * 
+ * Contributor(s): 
+ *  
+ * ***** END LICENSE BLOCK ***** */ 
+
+
+/**************************************************************************************
+ * Fixed-point MP3 decoder
+ *
+ * simdx86.h - packed versions of the assembly.h primitives, shared by the x86 SIMD
+ *               kernels
+ **************************************************************************************/
+
+#ifndef _SIMDX86_H
+#define _SIMDX86_H
+
+#include <immintrin.h>
+
+/* MULSHIFT32(x, c) on 4 lanes - top 32 bits of the signed 64-bit products, from pmuldq 
+ *   on the even and odd lanes
+ */
+__attribute__((target("sse4.1")))
+static __inline __m128i MulShift32SSE(__m128i x, __m128i c)
+{
+	__m128i lo, hi;
+
+	lo = _mm_srli_epi64(_mm_mul_epi32(x, c), 32);
+	hi = _mm_mul_epi32(_mm_srli_epi64(x, 32), _mm_srli_epi64(c, 32));
+
+	return _mm_blend_epi16(lo, hi, 0xcc);
+}
+
+/* MULSHIFT32(x, c) on 8 lanes */
+__attribute__((target("avx2")))
+static __inline __m256i MulShift32AVX(__m256i x, __m256i c)
+{
+	__m256i lo, hi;
+
+	lo = _mm256_srli_epi64(_mm256_mul_epi32(x, c), 32);
+	hi = _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(c, 32));
+
+	return _mm256_blend_epi32(lo, hi, 0xaa);
+}
+
+/* CLIP_2N(x, n) on 4 and 8 lanes */
+__attribute__((target("sse4.1")))
+static __inline __m128i Clip2NSSE(__m128i x, int n)
+{
+	x = _mm_max_epi32(x, _mm_set1_epi32(-(1 << n)));
+	return _mm_min_epi32(x, _mm_set1_epi32((1 << n) - 1));
+}
+
+__attribute__((target("avx2")))
+static __inline __m256i Clip2NAVX(__m256i x, int n)
+{
+	x = _mm256_max_epi32(x, _mm256_set1_epi32(-(1 << n)));
+	return _mm256_min_epi32(x, _mm256_set1_epi32((1 << n) - 1));
+}
+
+/* OR of all lanes */
+__attribute__((target("sse4.1")))
+static __inline int HorOrSSE(__m128i x)
+{
+	x = _mm_or_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(1,0,3,2)));
+	x = _mm_or_si128(x, _mm_shuffle_epi32(x, _MM_SHUFFLE(2,3,0,1)));
+	return _mm_cvtsi128_si32(x);
+}
+
+__attribute__((target("avx2")))
+static __inline int HorOrAVX(__m256i x)
+{
+	return HorOrSSE(_mm_or_si128(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+}
+
+#endif	/* _SIMDX86_H */